@@ -0,0 +1,80 @@
+//
+//  EFCompiledMapper.h
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFMapper.h"
+
+/**
+ *  Base class for mappers generated by `EFMappingCodeGenerator`
+ *
+ *  A compiled mapper handles exactly one class with straight-line code specialized for its mappings. Register it with `-[EFMapper registerMapper:forClass:]` on the mapper it was generated from. Instances of other classes, such as subclasses, and anything it does not handle itself are handed back to the mappings, initializers and mappers registered on that mapper.
+ */
+@interface EFCompiledMapper : EFMapper
+
+/**
+ *  Creates a compiled mapper
+ *
+ *  @param mapper The mapper holding the mappings the code was generated from
+ *  @param aClass Class handled by the compiled code
+ *
+ *  @return `EFCompiledMapper` instance
+ */
+- (instancetype)initWithMapper:(EFMapper *)mapper forClass:(Class)aClass;
+
+/**
+ *  Creates a compiled mapper which is only used if the mappings did not change since the code was generated
+ *
+ *  Generated code relies on the order, keys and classes of the mappings. The mappings are not looked up until the compiled mapper is first used, so classes adopting `EFMappable` still build their mappings on demand. If their fingerprints then differ from the ones the code was generated from, a warning is logged and the compiled mapper hands everything to the mappings.
+ *
+ *  @param mapper       The mapper holding the mappings the code was generated from
+ *  @param aClass       Class handled by the compiled code
+ *  @param fingerprints Fingerprints of the mappings the code was generated from, or nil to use the mappings unchecked
+ *
+ *  @return `EFCompiledMapper` instance
+ */
+- (instancetype)initWithMapper:(EFMapper *)mapper forClass:(Class)aClass fingerprints:(NSArray *)fingerprints;
+
+/**
+ *  Registers a compiled mapper for aClass on mapper
+ *
+ *  See `-initWithMapper:forClass:fingerprints:` for how changed mappings are handled.
+ *
+ *  @param mapper       The mapper holding the mappings the code was generated from
+ *  @param aClass       Class handled by the compiled code
+ *  @param fingerprints Fingerprints of the mappings the code was generated from
+ */
++ (void)registerWithMapper:(EFMapper *)mapper forClass:(Class)aClass fingerprints:(NSArray *)fingerprints;
+
+/**
+ *  Describes the parts of mappings that compiled code relies on
+ *
+ *  A fingerprint covers the keys, type and classes of a mapping, whether it has a formatter, transformation block or requirements, and the class of its transformer, including the table of an `EFEnumTransformer`.
+ *
+ *  @param mappings Array of `EFMapping` objects
+ *
+ *  @return Array with a fingerprint string for each mapping
+ */
++ (NSArray *)fingerprintsForMappings:(NSArray *)mappings;
+
+/**
+ *  The mapper holding the mappings the code was generated from
+ */
+@property (nonatomic, weak, readonly) EFMapper *mapper;
+
+/**
+ *  Class handled by the compiled code, or Nil if its mappings changed since the code was generated
+ */
+@property (nonatomic, assign, readonly) Class compiledClass;
+
+/**
+ *  Mappings registered for `compiledClass` at the time the compiled mapper was first used
+ *
+ *  Generated code refers to these by index for formatters, transformers, blocks and requirements.
+ */
+@property (nonatomic, copy, readonly) NSArray *compiledMappings;
+
+@end
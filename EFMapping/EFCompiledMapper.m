@@ -0,0 +1,150 @@
+//
+//  EFCompiledMapper.m
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFCompiledMapper.h"
+
+#import <libkern/OSAtomic.h>
+
+#import "EFMapper-Subclass.h"
+#import "EFMapping-Private.h"
+#import "EFEnumTransformer.h"
+
+@interface EFCompiledMapper () {
+    Class _compiledClass;
+    NSArray *_compiledMappings;
+    volatile BOOL _resolved;
+}
+
+@property (nonatomic, assign) Class mappedClass;
+@property (nonatomic, copy) NSArray *fingerprints;
+
+@end
+
+@implementation EFCompiledMapper
+
++ (void)registerWithMapper:(EFMapper *)mapper forClass:(Class)aClass fingerprints:(NSArray *)fingerprints {
+    [mapper registerMapper:[[self alloc] initWithMapper:mapper forClass:aClass fingerprints:fingerprints] forClass:aClass];
+}
+
++ (NSArray *)fingerprintsForMappings:(NSArray *)mappings {
+    NSMutableArray *fingerprints = [NSMutableArray arrayWithCapacity:[mappings count]];
+    for (EFMapping *mapping in mappings) {
+        NSMutableString *fingerprint = [NSMutableString stringWithFormat:@"%@ -> %@: ", mapping.externalKey, mapping.internalKey];
+        if (mapping.type == EFMappingTypeCollection) {
+            [fingerprint appendFormat:@"%@ of ", NSStringFromClass(mapping.collectionClass)];
+        }
+        [fingerprint appendString:NSStringFromClass(mapping.internalClass) ?: @"(null)"];
+        if (mapping.formatter) {
+            [fingerprint appendString:@", formatter"];
+        }
+        if (mapping.transformer) {
+            [fingerprint appendFormat:@", transformer %@", NSStringFromClass([mapping.transformer class])];
+            if ([mapping.transformer isKindOfClass:[EFEnumTransformer class]]) {
+                // Generated code inlines these tables
+                NSDictionary *enumMapping = ((EFEnumTransformer *)mapping.transformer).enumMapping;
+                NSMutableArray *entries = [NSMutableArray arrayWithCapacity:[enumMapping count]];
+                [enumMapping enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
+                    [entries addObject:[NSString stringWithFormat:@"%@ = %@", key, obj]];
+                }];
+                [fingerprint appendFormat:@" {%@}", [[entries sortedArrayUsingSelector:@selector(compare:)] componentsJoinedByString:@", "]];
+            }
+        }
+        if (mapping.transformationBlock) {
+            [fingerprint appendString:@", transformation block"];
+        }
+        if (mapping.requires) {
+            [fingerprint appendString:@", requires"];
+        }
+        [fingerprints addObject:fingerprint];
+    }
+    return fingerprints;
+}
+
+- (instancetype)initWithMapper:(EFMapper *)mapper forClass:(Class)aClass {
+    return [self initWithMapper:mapper forClass:aClass fingerprints:nil];
+}
+
+- (instancetype)initWithMapper:(EFMapper *)mapper forClass:(Class)aClass fingerprints:(NSArray *)fingerprints {
+    NSParameterAssert(mapper);
+    NSParameterAssert(aClass);
+    self = [super init];
+    if (self) {
+        _mapper = mapper;
+        _mappedClass = aClass;
+        _fingerprints = [fingerprints copy];
+    }
+    return self;
+}
+
+#pragma mark - Compiled mappings
+- (Class)compiledClass {
+    [self resolveCompiledMappingsIfNeeded];
+    return _compiledClass;
+}
+
+- (NSArray *)compiledMappings {
+    [self resolveCompiledMappingsIfNeeded];
+    return _compiledMappings;
+}
+
+- (void)resolveCompiledMappingsIfNeeded {
+    BOOL resolved = _resolved;
+    // Pairs with the barrier before publishing, so the compiled class and mappings are seen once resolved is
+    OSMemoryBarrier();
+    if (resolved) {
+        return;
+    }
+
+    // Ask for the mappings without holding the lock, resolving them may use the mapper
+    NSArray *mappings = [self.mapper mappingsForClass:self.mappedClass];
+    BOOL matches = !self.fingerprints || [[[self class] fingerprintsForMappings:mappings] isEqualToArray:self.fingerprints];
+
+    @synchronized(self) {
+        if (_resolved) {
+            return;
+        }
+        if (matches) {
+            _compiledClass = self.mappedClass;
+            _compiledMappings = [mappings copy];
+        } else {
+            // Leaving the compiled class unset hands every call to the mappings
+            NSLog(@"Mappings for %@ changed since %@ was generated, using mappings instead. Regenerate the compiled mappers.", NSStringFromClass(self.mappedClass), NSStringFromClass([self class]));
+        }
+        OSMemoryBarrier();
+        _resolved = YES;
+    }
+}
+
+#pragma mark - Lookup
+- (EFMapper *)mapperForClass:(Class)aClass {
+    EFMapper *mapper = self.mapper;
+    return mapper ? [mapper mapperForClass:aClass] : self;
+}
+
+- (NSArray *)mappingsForClass:(Class)aClass {
+    return [self.mapper mappingsForClass:aClass];
+}
+
+- (EFMappingInitializerBlock)initializerForClass:(Class)aClass {
+    return [self.mapper initializerForClass:aClass];
+}
+
+- (NSArray *)dictionaryRepresentationKeysForClass:(Class)aClass {
+    return [self.mapper dictionaryRepresentationKeysForClass:aClass];
+}
+
+#pragma mark - Interning
+- (EFInterningPool *)interningPool {
+    return self.mapper.interningPool;
+}
+
+- (NSSet *)internedClasses {
+    return self.mapper.internedClasses;
+}
+
+@end
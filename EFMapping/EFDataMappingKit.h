@@ -14,3 +14,5 @@
 #import "EFMappingError.h"
 #import "NSDateFormatter+EFMapping.h"
 #import "EFEnumTransformer.h"
+#import "EFInterningPool.h"
+#import "EFCompiledMapper.h"
@@ -0,0 +1,72 @@
+//
+//  EFInterningPool.h
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ *  `EFInterningPool` deduplicates equal `NSString` and `NSNumber` values so that all mapped objects can share one immutable instance.
+ *
+ *  Attach a pool to an `EFMapper` via its `interningPool` property to have mapped values pass through it. The pool is bounded: once it holds `capacity` distinct values, a value that has not been seen again since it was added is evicted to make room, so repeated values stay in the pool while one-off values such as identifiers cycle through. It is safe to use the same pool from multiple threads and mappers.
+ */
+@interface EFInterningPool : NSObject
+
+/** @name Creating pools */
+/**
+ *  Creates a pool with a default capacity of 4096 distinct values
+ *
+ *  @return `EFInterningPool` instance
+ */
+- (instancetype)init;
+
+/**
+ *  Creates a pool
+ *
+ *  @param capacity Maximum number of distinct values held by the pool
+ *
+ *  @return `EFInterningPool` instance
+ */
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+/** @name Interning values */
+/**
+ *  Returns the shared instance for a value
+ *
+ *  Only `NSString` and `NSNumber` values are interned. Mutable strings are copied before being added to the pool, so the returned instance is always immutable. Any other value is returned as is.
+ *
+ *  @param value Value to intern
+ *
+ *  @return Shared instance equal to value, or value itself
+ */
+- (id)internedValue:(id)value;
+
+/**
+ *  Removes all values from the pool and resets its statistics
+ *
+ *  Objects that already hold interned values keep them.
+ */
+- (void)removeAllValues;
+
+/** @name Statistics */
+/**
+ *  Maximum number of distinct values held by the pool
+ */
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+
+/**
+ *  Number of distinct values currently held by the pool
+ */
+@property (nonatomic, assign, readonly) NSUInteger count;
+
+/**
+ *  Estimated number of heap bytes saved by handing out shared instances instead of duplicates
+ *
+ *  This is an upper bound. The size of a duplicate is added each time it is replaced by the shared instance, so a duplicate passed in more than once counts more than once, and it only saves memory once nothing else holds on to it. Values that are not heap allocated, such as tagged pointers, do not count towards this number.
+ */
+@property (nonatomic, assign, readonly) unsigned long long savedBytes;
+
+@end
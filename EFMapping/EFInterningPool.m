@@ -0,0 +1,111 @@
+//
+//  EFInterningPool.m
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFInterningPool.h"
+
+#import <malloc/malloc.h>
+
+static NSUInteger const EFInterningPoolDefaultCapacity = 4096;
+
+@interface EFInterningPool ()
+
+@property (nonatomic, strong) NSMutableDictionary *slotsByValue;
+@property (nonatomic, strong) NSMutableArray *slots;
+@property (nonatomic, strong) NSMutableIndexSet *referencedSlots;
+@property (nonatomic, assign) NSUInteger hand;
+@property (nonatomic, assign, readwrite) unsigned long long savedBytes;
+
+@end
+
+@implementation EFInterningPool
+
+- (instancetype)init {
+    return [self initWithCapacity:EFInterningPoolDefaultCapacity];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    self = [super init];
+    if (self) {
+        _capacity = capacity;
+        _slotsByValue = [NSMutableDictionary dictionary];
+        _slots = [NSMutableArray array];
+        _referencedSlots = [NSMutableIndexSet indexSet];
+    }
+    return self;
+}
+
+- (id)internedValue:(id)value {
+    BOOL isString = [value isKindOfClass:[NSString class]];
+    if (!isString && ![value isKindOfClass:[NSNumber class]]) {
+        return value;
+    }
+
+    @synchronized(self) {
+        NSNumber *slot = self.slotsByValue[value];
+        if (slot) {
+            id existingValue = self.slots[[slot unsignedIntegerValue]];
+            // @YES equals @1 and @1 equals @1.0, only share numbers that are truly the same
+            if (!isString && ([existingValue class] != [value class] || strcmp([existingValue objCType], [value objCType]) != 0)) {
+                return value;
+            }
+            [self.referencedSlots addIndex:[slot unsignedIntegerValue]];
+            if (existingValue == value) {
+                return value;
+            }
+            // Tagged pointers are not heap allocated, malloc_size returns 0 for those
+            self.savedBytes += malloc_size((__bridge const void *)value);
+            return existingValue;
+        }
+
+        if (self.capacity == 0) {
+            return value;
+        }
+
+        id immutableValue = isString ? [value copy] : value;
+        if ([self.slots count] < self.capacity) {
+            self.slotsByValue[immutableValue] = @([self.slots count]);
+            [self.slots addObject:immutableValue];
+            return immutableValue;
+        }
+
+        // Pool is full, evict the first value not seen again since the hand last passed it (clock)
+        while ([self.referencedSlots containsIndex:self.hand]) {
+            [self.referencedSlots removeIndex:self.hand];
+            self.hand = (self.hand + 1) % self.capacity;
+        }
+        [self.slotsByValue removeObjectForKey:self.slots[self.hand]];
+        self.slots[self.hand] = immutableValue;
+        self.slotsByValue[immutableValue] = @(self.hand);
+        self.hand = (self.hand + 1) % self.capacity;
+        return immutableValue;
+    }
+}
+
+- (void)removeAllValues {
+    @synchronized(self) {
+        [self.slotsByValue removeAllObjects];
+        [self.slots removeAllObjects];
+        [self.referencedSlots removeAllIndexes];
+        self.hand = 0;
+        self.savedBytes = 0;
+    }
+}
+
+- (NSUInteger)count {
+    @synchronized(self) {
+        return [self.slots count];
+    }
+}
+
+- (unsigned long long)savedBytes {
+    @synchronized(self) {
+        return _savedBytes;
+    }
+}
+
+@end
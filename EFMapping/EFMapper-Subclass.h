@@ -15,6 +15,112 @@
  */
 @interface EFMapper ()
 
+#pragma mark - Lookup
+
+/**
+ *  Mapper responsible for a class
+ *
+ *  @param aClass Class of object
+ *
+ *  @return Registered `EFMapper` instance for the class or one of its superclasses, or the receiver if none registered
+ */
+- (EFMapper *)mapperForClass:(Class)aClass;
+
+/**
+ *  Mappings used for a class
+ *
+ *  @param aClass Class of object
+ *
+ *  @return Array of `EFMapping` instances registered for, or provided by, the class or one of its superclasses, or nil if none registered
+ */
+- (NSArray *)mappingsForClass:(Class)aClass;
+
+/**
+ *  Initializer used for a class
+ *
+ *  @param aClass Class of object
+ *
+ *  @return Initializer registered for, or provided by, the class or one of its superclasses, or nil if none registered
+ */
+- (EFMappingInitializerBlock)initializerForClass:(Class)aClass;
+
+/**
+ *  Keys included in the dictionary representation of a class
+ *
+ *  @param aClass Class of object
+ *
+ *  @return Keys registered for, or provided by, the class or one of its superclasses, or nil if none registered
+ */
+- (NSArray *)dictionaryRepresentationKeysForClass:(Class)aClass;
+
+#pragma mark - Applying mappings
+
+/**
+ *  Validates values to be applied to an instance of a class, optionally also using KVC validation on an instance
+ *
+ *  Both public validation methods end up here.
+ *
+ *  @param values The values to be validated
+ *  @param aClass Class of object
+ *  @param object The object, or nil
+ *  @param error  On input, a pointer to an error object. If an error occurs, this pointer is set to an actual error object containing the error information. You may specify `nil` for this parameter if you do not want the error information.
+ *
+ *  @return YES if all values are valid, NO otherwise
+ */
+- (BOOL)validateValues:(NSDictionary *)values forClass:(Class)aClass onObject:(id)object error:(NSError **)error;
+
+/**
+ *  Validates the value for a single mapping
+ *
+ *  @param values  The values to be validated
+ *  @param mapping `EFMapping` instance
+ *  @param object  The object, or nil
+ *  @param errors  Dictionary to which any error is added, using the internal key of the mapping as key
+ */
+- (void)validateValues:(NSDictionary *)values mapping:(EFMapping *)mapping onObject:(id)object errors:(NSMutableDictionary *)errors;
+
+/**
+ *  Turns collected validation errors into a result
+ *
+ *  @param errors Dictionary of errors by internal key
+ *  @param aClass Class of object
+ *  @param error  On input, a pointer to an error object. If an error occurs, this pointer is set to an actual error object containing the error information. You may specify `nil` for this parameter if you do not want the error information.
+ *
+ *  @return YES if there are no errors, NO otherwise
+ */
+- (BOOL)validationResultWithErrors:(NSDictionary *)errors forClass:(Class)aClass error:(NSError **)error;
+
+/**
+ *  Applies the value for a single mapping to an already validated object
+ *
+ *  @param values  The values to be applied
+ *  @param object  The object
+ *  @param mapping `EFMapping` instance
+ *  @param error   On input, a pointer to an error object. If an error occurs, this pointer is set to an actual error object containing the error information. You may specify `nil` for this parameter if you do not want the error information.
+ */
+- (void)setValues:(NSDictionary *)values onObject:(id)object mapping:(EFMapping *)mapping error:(NSError **)error;
+
+/**
+ *  Adds the dictionary representation of the value for a single mapping
+ *
+ *  @param object     The object
+ *  @param mapping    `EFMapping` instance
+ *  @param dictionary Dictionary to which the representation is added, using the external key of the mapping as key
+ */
+- (void)addDictionaryRepresentationOfObject:(id)object mapping:(EFMapping *)mapping toDictionary:(NSMutableDictionary *)dictionary;
+
+/**
+ *  Deduplicates a value through the interning pool, if enabled for the mapping
+ *
+ *  @param value   Transformed and validated value
+ *  @param mapping `EFMapping` instance
+ *
+ *  @return Interned value, or value itself
+ */
+- (id)internedValue:(id)value mapping:(EFMapping *)mapping;
+
+#pragma mark - Per value hooks
+
 /**
  *  Transforms (if needed) any incoming value
  *
@@ -18,6 +18,40 @@
  */
 typedef id (^EFMappingInitializerBlock)(Class aClass, NSDictionary *values);
 
+@class EFInterningPool;
+
+/**
+ *  Protocol for classes that provide their own mappings
+ *
+ *  Instead of registering mappings up front, a class can implement these class methods. `EFMapper` calls them the first time it needs the mappings, initializer or dictionary representation keys of that class, and caches the result. Anything registered explicitly on the mapper takes precedence. The methods are called without holding any lock of the mapper, so they may use the mapper themselves. A method is called once per mapper, except when the class is first used from multiple threads at the same time: each of those may call it, and the first result is used by all.
+ */
+@protocol EFMappable <NSObject>
+
+@optional
+
+/**
+ *  Mappings to be used for setting values on instances of the class
+ *
+ *  @return Array of `EFMapping` instances
+ */
++ (NSArray *)ef_mappings;
+
+/**
+ *  Initializer to be called when the mapper needs to instantiate the class
+ *
+ *  @return Block returning class instance
+ */
++ (EFMappingInitializerBlock)ef_initializer;
+
+/**
+ *  Keys that should be included in a dictionary representation
+ *
+ *  @return Array of `NSString` keys
+ */
++ (NSArray *)ef_dictionaryRepresentationKeys;
+
+@end
+
 /**
  *  `EFMapper` maps data such as those coming from JSON onto an instance using mappings. The mappings are also used to simplify implementing the `NSCoding` protocol for a class, and to create a dictionary representation of an instance.
  */
@@ -41,7 +75,7 @@ typedef id (^EFMappingInitializerBlock)(Class aClass, NSDictionary *values);
 /**
  *  Mappings to be used for setting values on instances of a class
  *
- *  Mappings are also used for subclasses of the class, unless more specific mappings for that subclass are registered.
+ *  Mappings are also used for subclasses of the class, unless more specific mappings for that subclass are registered. To avoid building mappings for classes that may never be used, implement `+[EFMappable ef_mappings]` on the class instead.
  *
  *  @param mappings Array of `EFMapping` instances
  *  @param aClass   Class for which the mappings should be used
@@ -58,6 +92,23 @@ typedef id (^EFMappingInitializerBlock)(Class aClass, NSDictionary *values);
  */
 - (void)registerMapper:(EFMapper *)mapper forClass:(Class)aClass;
 
+#pragma mark - Interning
+/** @name Interning */
+
+/**
+ *  Pool used to deduplicate mapped values
+ *
+ *  Values are only interned for mappings that have `interned` set, or whose `internalClass` is in `internedClasses`. Collections are not interned themselves, but their `NSString` and `NSNumber` children are. Values set on scalar properties, such as numbers for `NSInteger` or `BOOL` properties, are not interned as the boxed value is not kept. Defaults to nil, which disables interning.
+ */
+@property (nonatomic, strong) EFInterningPool *interningPool;
+
+/**
+ *  Internal classes for which values are always interned
+ *
+ *  For example pass `[NSSet setWithObject:[NSString class]]` to intern all string values, regardless of the `interned` property of their mappings.
+ */
+@property (nonatomic, copy) NSSet *internedClasses;
+
 #pragma mark - Initializers
 /** @name Initializers */
 
@@ -8,19 +8,51 @@
 
 #import "EFMapper.h"
 
+#import <objc/runtime.h>
+#import <pthread.h>
+
 #import "EFMapper-Subclass.h"
 #import "EFMapping-Private.h"
 #import "EFMappingError.h"
+#import "EFInterningPool.h"
 
-@interface EFMapper ()
+@interface EFMapper () {
+    pthread_rwlock_t _lock;
+}
 
 @property (nonatomic, strong) NSMutableDictionary *mappers;
 @property (nonatomic, strong) NSMutableDictionary *mappings;
 @property (nonatomic, strong) NSMutableDictionary *initializers;
 @property (nonatomic, strong) NSMutableDictionary *dictionaryKeys;
+@property (nonatomic, strong) NSMutableSet *resolvedClasses;
 
 @end
 
+static BOOL EFClassImplementsClassMethod(Class aClass, SEL selector) {
+    Method method = class_getClassMethod(aClass, selector);
+    if (!method) {
+        return NO;
+    }
+
+    // Inherited implementations are picked up when resolving the superclass
+    Class superClass = [aClass superclass];
+    Method superMethod = superClass != Nil ? class_getClassMethod(superClass, selector) : NULL;
+    return !superMethod || method_getImplementation(method) != method_getImplementation(superMethod);
+}
+
+static BOOL EFClassStoresObjectForKey(Class aClass, NSString *key) {
+    objc_property_t property = class_getProperty(aClass, [key UTF8String]);
+    if (!property) {
+        // Can't tell without a declared property
+        return YES;
+    }
+
+    char *type = property_copyAttributeValue(property, "T");
+    BOOL storesObject = type && type[0] == '@';
+    free(type);
+    return storesObject;
+}
+
 @implementation EFMapper
 
 + (instancetype)sharedInstance {
@@ -37,78 +69,124 @@
 - (instancetype)init {
     self = [super init];
     if (self) {
+        pthread_rwlock_init(&_lock, NULL);
         _mappers = [NSMutableDictionary dictionary];
         _mappings = [NSMutableDictionary dictionary];
         _initializers = [NSMutableDictionary dictionary];
         _dictionaryKeys = [NSMutableDictionary dictionary];
+        _resolvedClasses = [NSMutableSet set];
     }
     return self;
 }
 
-- (void)registerMapper:(EFMapper *)mapper forClass:(Class)aClass {
-    if (mapper) {
-        self.mappers[NSStringFromClass(aClass)] = mapper;
+- (void)dealloc {
+    pthread_rwlock_destroy(&_lock);
+}
+
+- (void)registerObject:(id)object inRegistry:(NSMutableDictionary *)registry forClass:(Class)aClass {
+    pthread_rwlock_wrlock(&_lock);
+    if (object) {
+        registry[NSStringFromClass(aClass)] = object;
     } else {
-        [self.mappers removeObjectForKey:NSStringFromClass(aClass)];
+        [registry removeObjectForKey:NSStringFromClass(aClass)];
     }
+    pthread_rwlock_unlock(&_lock);
 }
 
-- (EFMapper *)mapperForClass:(Class)aClass {
-    EFMapper *mapper = self.mappers[NSStringFromClass(aClass)];
-    if (mapper) {
-        return mapper;
-    } else {
-        Class superClass = [aClass superclass];
-        if (superClass != Nil) {
-            return [self mapperForClass:superClass];
-        } else {
-            return self;
+- (id)registeredObjectInRegistry:(NSDictionary *)registry forClass:(Class)aClass resolve:(BOOL)resolve {
+    while (YES) {
+        id object = nil;
+        Class unresolvedClass = Nil;
+
+        // Walk up the superclasses under a single read lock, mapping concurrently only contends when registering
+        pthread_rwlock_rdlock(&_lock);
+        for (Class currentClass = aClass; currentClass != Nil; currentClass = [currentClass superclass]) {
+            NSString *className = NSStringFromClass(currentClass);
+            if (resolve && ![self.resolvedClasses containsObject:className]) {
+                unresolvedClass = currentClass;
+                break;
+            }
+            object = registry[className];
+            if (object) {
+                break;
+            }
+        }
+        pthread_rwlock_unlock(&_lock);
+
+        if (unresolvedClass == Nil) {
+            return object;
         }
+        [self resolveMappableClass:unresolvedClass];
     }
 }
 
+- (void)registerMapper:(EFMapper *)mapper forClass:(Class)aClass {
+    [self registerObject:mapper inRegistry:self.mappers forClass:aClass];
+}
+
+- (EFMapper *)mapperForClass:(Class)aClass {
+    return [self registeredObjectInRegistry:self.mappers forClass:aClass resolve:NO] ?: self;
+}
+
 - (void)registerMappings:(NSArray *)mappings forClass:(Class)aClass {
-    if (mappings) {
-        self.mappings[NSStringFromClass(aClass)] = mappings;
-    } else {
-        [self.mappings removeObjectForKey:NSStringFromClass(aClass)];
-    }
+    [self registerObject:mappings inRegistry:self.mappings forClass:aClass];
 }
 
 - (NSArray *)mappingsForClass:(Class)aClass {
-    NSArray *mappings = self.mappings[NSStringFromClass(aClass)];
-    if (mappings) {
-        return mappings;
-    } else {
-        Class superClass = [aClass superclass];
-        if (superClass != Nil) {
-            return [self mappingsForClass:superClass];
-        } else {
-            return nil;
-        }
-    }
+    return [self registeredObjectInRegistry:self.mappings forClass:aClass resolve:YES];
 }
 
 - (void)registerInitializer:(EFMappingInitializerBlock)initializerBlock forClass:(Class)aClass {
-    if (initializerBlock) {
-        self.initializers[NSStringFromClass(aClass)] = [initializerBlock copy];
-    } else {
-        [self.initializers removeObjectForKey:NSStringFromClass(aClass)];
-    }
+    [self registerObject:[initializerBlock copy] inRegistry:self.initializers forClass:aClass];
 }
 
 - (EFMappingInitializerBlock)initializerForClass:(Class)aClass {
-    EFMappingInitializerBlock initializer = self.initializers[NSStringFromClass(aClass)];
-    if (initializer) {
-        return initializer;
-    } else {
-        Class superClass = [aClass superclass];
-        if (superClass != Nil) {
-            return [self initializerForClass:superClass];
-        } else {
-            return nil;
+    return [self registeredObjectInRegistry:self.initializers forClass:aClass resolve:YES];
+}
+
+- (void)resolveMappableClass:(Class)aClass {
+    NSString *className = NSStringFromClass(aClass);
+
+    // Explicit registrations take precedence
+    pthread_rwlock_rdlock(&_lock);
+    BOOL resolved = [self.resolvedClasses containsObject:className];
+    BOOL needsMappings = !self.mappings[className];
+    BOOL needsInitializer = !self.initializers[className];
+    BOOL needsDictionaryKeys = !self.dictionaryKeys[className];
+    pthread_rwlock_unlock(&_lock);
+    if (resolved) {
+        return;
+    }
+
+    // Ask the class without holding the lock, it may do anything including using this mapper
+    NSArray *mappings = nil;
+    if (needsMappings && EFClassImplementsClassMethod(aClass, @selector(ef_mappings))) {
+        mappings = [(Class <EFMappable>)aClass ef_mappings];
+    }
+    EFMappingInitializerBlock initializer = nil;
+    if (needsInitializer && EFClassImplementsClassMethod(aClass, @selector(ef_initializer))) {
+        initializer = [[(Class <EFMappable>)aClass ef_initializer] copy];
+    }
+    NSArray *keys = nil;
+    if (needsDictionaryKeys && EFClassImplementsClassMethod(aClass, @selector(ef_dictionaryRepresentationKeys))) {
+        keys = [(Class <EFMappable>)aClass ef_dictionaryRepresentationKeys];
+    }
+
+    // Another thread may have resolved the class or registered for it in the meantime
+    pthread_rwlock_wrlock(&_lock);
+    if (![self.resolvedClasses containsObject:className]) {
+        [self.resolvedClasses addObject:className];
+        if (mappings && !self.mappings[className]) {
+            self.mappings[className] = mappings;
+        }
+        if (initializer && !self.initializers[className]) {
+            self.initializers[className] = initializer;
+        }
+        if (keys && !self.dictionaryKeys[className]) {
+            self.dictionaryKeys[className] = keys;
         }
     }
+    pthread_rwlock_unlock(&_lock);
 }
 
 - (BOOL)validateValues:(NSDictionary *)values forClass:(Class)aClass error:(NSError **)error {
@@ -138,115 +216,104 @@
 
     NSArray *mappings = [self mappingsForClass:aClass];
     for (EFMapping *mapping in mappings) {
-        id value = values[mapping.externalKey];
+        [self validateValues:values mapping:mapping onObject:object errors:errors];
+    }
 
-        switch (mapping.type) {
-            case EFMappingTypeId: {
-                NSError *transformError = nil;
-                id transformedValue = [self transformValue:value mapping:mapping reverse:NO error:&transformError];
-                if (value && !transformedValue) {
-                    errors[mapping.internalKey] = transformError;
-                }
+    return [self validationResultWithErrors:errors forClass:aClass error:error];
+}
 
-                NSError *validationError = nil;
-                BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
+- (void)validateValues:(NSDictionary *)values mapping:(EFMapping *)mapping onObject:(id)object errors:(NSMutableDictionary *)errors {
+    id value = values[mapping.externalKey];
+
+    switch (mapping.type) {
+        case EFMappingTypeId: {
+            NSError *transformError = nil;
+            id transformedValue = [self transformValue:value mapping:mapping reverse:NO error:&transformError];
+            if (value && !transformedValue) {
+                errors[mapping.internalKey] = transformError;
+            }
+
+            NSError *validationError = nil;
+            BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
+            if (!valid) {
+                errors[mapping.internalKey] = validationError;
+            }
+
+            if (object) {
+                // NSKeyValueCoding validation
+                NSError *validationError;
+                BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
                 if (!valid) {
                     errors[mapping.internalKey] = validationError;
                 }
+            }
+        }
+            break;
+        case EFMappingTypeCollection:
+            if ([mapping.collectionClass isSubclassOfClass:[NSArray class]] && [value isKindOfClass:[NSArray class]]) {
+                NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
+                NSMutableArray *errorsInArray = [NSMutableArray array];
+                for (__strong id child in value) {
+                    NSError *transformError = nil;
+                    id transformedValue = [self transformValue:child mapping:mapping reverse:NO error:&transformError];
+                    if (child && !transformedValue) {
+                        [errorsInArray addObject:transformError];
+                    }
 
-                if (object) {
-                    // NSKeyValueCoding validation
-                    NSError *validationError;
-                    BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
+                    NSError *validationError = nil;
+                    BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
                     if (!valid) {
-                        errors[mapping.internalKey] = validationError;
+                        [errorsInArray addObject:validationError];
+                    } else {
+                        [array addObject:transformedValue];
                     }
                 }
-            }
-                break;
-            case EFMappingTypeCollection:
-                if ([mapping.collectionClass isSubclassOfClass:[NSArray class]] && [value isKindOfClass:[NSArray class]]) {
-                    NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
-                    NSMutableArray *errorsInArray = [NSMutableArray array];
-                    for (__strong id child in value) {
-                        NSError *transformError = nil;
-                        id transformedValue = [self transformValue:child mapping:mapping reverse:NO error:&transformError];
-                        if (child && !transformedValue) {
-                            [errorsInArray addObject:transformError];
-                        }
 
-                        NSError *validationError = nil;
-                        BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
-                        if (!valid) {
-                            [errorsInArray addObject:validationError];
-                        } else {
-                            [array addObject:transformedValue];
-                        }
-                    }
+                if ([errorsInArray count] > 0) {
+                    NSString *description = [NSString stringWithFormat:@"Encountered %lu validation error%@ in array for key %@", (unsigned long)[errorsInArray count], [errorsInArray count] == 1 ? @"" : @"s", mapping.internalKey];
+                    NSError *validationError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description, EFMappingErrorValidationErrorsKey: errorsInArray}];
+                    errors[mapping.internalKey] = validationError;
+                } else {
+                    // Don't apply transform, that is for the internal classes!
 
-                    if ([errorsInArray count] > 0) {
-                        NSString *description = [NSString stringWithFormat:@"Encountered %lu validation error%@ in array for key %@", (unsigned long)[errorsInArray count], [errorsInArray count] == 1 ? @"" : @"s", mapping.internalKey];
-                        NSError *validationError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description, EFMappingErrorValidationErrorsKey: errorsInArray}];
+                    NSError *validationError = nil;
+                    BOOL valid = [self validateValue:value isCollection:YES mapping:mapping error:&validationError];
+                    if (!valid) {
                         errors[mapping.internalKey] = validationError;
-                    } else {
-                        // Don't apply transform, that is for the internal classes!
+                    }
 
-                        NSError *validationError = nil;
-                        BOOL valid = [self validateValue:value isCollection:YES mapping:mapping error:&validationError];
+                    if (object) {
+                        // NSKeyValueCoding validation
+                        NSError *validationError;
+                        BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
                         if (!valid) {
                             errors[mapping.internalKey] = validationError;
                         }
-
-                        if (object) {
-                            // NSKeyValueCoding validation
-                            NSError *validationError;
-                            BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
-                            if (!valid) {
-                                errors[mapping.internalKey] = validationError;
-                            }
-                        }
                     }
-                } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]] && [value isKindOfClass:[NSDictionary class]]) {
-                    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[value count]];
-                    NSMutableDictionary *errorsInDictionary = [NSMutableDictionary dictionary];
-                    [value enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
-                        NSError *transformError = nil;
-                        id transformedValue = [self transformValue:child mapping:mapping reverse:NO error:&transformError];
-                        if (child && !transformedValue) {
-                            errorsInDictionary[key] = transformError;
-                        }
-
-                        NSError *validationError = nil;
-                        BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
-                        if (!valid) {
-                            errorsInDictionary[key] = validationError;
-                        } else {
-                            dictionary[key] = child;
-                        }
-                    }];
+                }
+            } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]] && [value isKindOfClass:[NSDictionary class]]) {
+                NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[value count]];
+                NSMutableDictionary *errorsInDictionary = [NSMutableDictionary dictionary];
+                [value enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
+                    NSError *transformError = nil;
+                    id transformedValue = [self transformValue:child mapping:mapping reverse:NO error:&transformError];
+                    if (child && !transformedValue) {
+                        errorsInDictionary[key] = transformError;
+                    }
 
-                    if ([errorsInDictionary count] > 0) {
-                        NSString *description = [NSString stringWithFormat:@"Encountered %lu validation error%@ in dictionary for key %@", (unsigned long)[errorsInDictionary count], [errorsInDictionary count] == 1 ? @"" : @"s", mapping.internalKey];
-                        NSError *validationError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description, EFMappingErrorValidationErrorsKey: errorsInDictionary}];
-                        errors[mapping.internalKey] = validationError;
+                    NSError *validationError = nil;
+                    BOOL valid = [self validateValue:transformedValue isCollection:NO mapping:mapping error:&validationError];
+                    if (!valid) {
+                        errorsInDictionary[key] = validationError;
                     } else {
-                        // Don't apply transform, that is for the internal classes!
-
-                        NSError *validationError = nil;
-                        BOOL valid = [self validateValue:value isCollection:YES mapping:mapping error:&validationError];
-                        if (!valid) {
-                            errors[mapping.internalKey] = validationError;
-                        }
-
-                        if (object) {
-                            // NSKeyValueCoding validation
-                            NSError *validationError;
-                            BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
-                            if (!valid) {
-                                errors[mapping.internalKey] = validationError;
-                            }
-                        }
+                        dictionary[key] = child;
                     }
+                }];
+
+                if ([errorsInDictionary count] > 0) {
+                    NSString *description = [NSString stringWithFormat:@"Encountered %lu validation error%@ in dictionary for key %@", (unsigned long)[errorsInDictionary count], [errorsInDictionary count] == 1 ? @"" : @"s", mapping.internalKey];
+                    NSError *validationError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description, EFMappingErrorValidationErrorsKey: errorsInDictionary}];
+                    errors[mapping.internalKey] = validationError;
                 } else {
                     // Don't apply transform, that is for the internal classes!
 
@@ -265,12 +332,31 @@
                         }
                     }
                 }
-                break;
-            default:
-                break;
-        }
+            } else {
+                // Don't apply transform, that is for the internal classes!
+
+                NSError *validationError = nil;
+                BOOL valid = [self validateValue:value isCollection:YES mapping:mapping error:&validationError];
+                if (!valid) {
+                    errors[mapping.internalKey] = validationError;
+                }
+
+                if (object) {
+                    // NSKeyValueCoding validation
+                    NSError *validationError;
+                    BOOL valid = [object validateValue:&value forKey:mapping.internalKey error:&validationError];
+                    if (!valid) {
+                        errors[mapping.internalKey] = validationError;
+                    }
+                }
+            }
+            break;
+        default:
+            break;
     }
+}
 
+- (BOOL)validationResultWithErrors:(NSDictionary *)errors forClass:(Class)aClass error:(NSError **)error {
     if ([errors count] > 0) {
         if (error != NULL) {
             NSString *description = [NSString stringWithFormat:NSLocalizedString(@"Encountered %d validation error%@ in %@", @""), [errors count], [errors count] == 1 ? @"" : @"s", NSStringFromClass(aClass)];
@@ -296,50 +382,56 @@
 
     NSArray *mappings = [self mappingsForClass:[object class]];
     for (EFMapping *mapping in mappings) {
-        id value = values[mapping.externalKey];
+        [self setValues:values onObject:object mapping:mapping error:error];
+    }
+    return YES;
+}
 
-        switch (mapping.type) {
-            case EFMappingTypeId: {
-                id transformedValue = [self transformValue:value mapping:mapping reverse:NO error:NULL];
-                [self setValue:transformedValue onObject:object isCollection:NO mapping:mapping];
-            }
-                break;
-            case EFMappingTypeCollection:
-                if ([mapping.collectionClass isSubclassOfClass:[NSArray class]]) {
-                    NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
-                    for (id child in value) {
-                        id transformedChild = [self transformValue:child mapping:mapping reverse:NO error:NULL];
-                        if (![transformedChild isKindOfClass:mapping.internalClass] && [transformedChild isKindOfClass:[NSDictionary class]] && [self mappingsForClass:mapping.internalClass]) {
-                            transformedChild = [self objectOfClass:mapping.internalClass withValues:transformedChild error:error];
-                        }
-                        if (transformedChild) {
-                            [array addObject:transformedChild];
-                        }
+- (void)setValues:(NSDictionary *)values onObject:(id)object mapping:(EFMapping *)mapping error:(NSError **)error {
+    id value = values[mapping.externalKey];
+
+    switch (mapping.type) {
+        case EFMappingTypeId: {
+            id transformedValue = [self transformValue:value mapping:mapping reverse:NO error:NULL];
+            [self setValue:transformedValue onObject:object isCollection:NO mapping:mapping];
+        }
+            break;
+        case EFMappingTypeCollection:
+            if ([mapping.collectionClass isSubclassOfClass:[NSArray class]]) {
+                NSMutableArray *array = [NSMutableArray arrayWithCapacity:[value count]];
+                for (id child in value) {
+                    id transformedChild = [self transformValue:child mapping:mapping reverse:NO error:NULL];
+                    if (![transformedChild isKindOfClass:mapping.internalClass] && [transformedChild isKindOfClass:[NSDictionary class]] && [self mappingsForClass:mapping.internalClass]) {
+                        transformedChild = [self objectOfClass:mapping.internalClass withValues:transformedChild error:error];
+                    }
+                    transformedChild = [self internedValue:transformedChild mapping:mapping];
+                    if (transformedChild) {
+                        [array addObject:transformedChild];
                     }
-                    id collectionValue = [[mapping.collectionClass alloc] initWithArray:array];
-                    [self setValue:collectionValue onObject:object isCollection:YES mapping:mapping];
-                } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]]) {
-                    NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[value count]];
-                    [value enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
-                        id transformedChild = [self transformValue:child mapping:mapping reverse:NO error:NULL];
-                        if (![transformedChild isKindOfClass:mapping.internalClass] && [transformedChild isKindOfClass:[NSDictionary class]] && [self mappingsForClass:mapping.internalClass]) {
-                            transformedChild = [self objectOfClass:mapping.internalClass withValues:transformedChild error:error];
-                        }
-                        if (transformedChild) {
-                            dictionary[key] = transformedChild;
-                        }
-                    }];
-                    id collectionValue = [[mapping.collectionClass alloc] initWithDictionary:dictionary];
-                    [self setValue:collectionValue onObject:object isCollection:YES mapping:mapping];
-                } else {
-                    continue;
                 }
-                break;
-            default:
-                break;
-        }
+                id collectionValue = [[mapping.collectionClass alloc] initWithArray:array];
+                [self setValue:collectionValue onObject:object isCollection:YES mapping:mapping];
+            } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]]) {
+                NSMutableDictionary *dictionary = [NSMutableDictionary dictionaryWithCapacity:[value count]];
+                [value enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
+                    id transformedChild = [self transformValue:child mapping:mapping reverse:NO error:NULL];
+                    if (![transformedChild isKindOfClass:mapping.internalClass] && [transformedChild isKindOfClass:[NSDictionary class]] && [self mappingsForClass:mapping.internalClass]) {
+                        transformedChild = [self objectOfClass:mapping.internalClass withValues:transformedChild error:error];
+                    }
+                    transformedChild = [self internedValue:transformedChild mapping:mapping];
+                    if (transformedChild) {
+                        dictionary[key] = transformedChild;
+                    }
+                }];
+                id collectionValue = [[mapping.collectionClass alloc] initWithDictionary:dictionary];
+                [self setValue:collectionValue onObject:object isCollection:YES mapping:mapping];
+            } else {
+                return;
+            }
+            break;
+        default:
+            break;
     }
-    return YES;
 }
 
 - (id)objectOfClass:(Class)aClass withValues:(NSDictionary *)values error:(NSError **)error {
@@ -467,9 +559,25 @@
     // NSKeyValueCoding validation: gives classes a chance to implement validation too
     [object validateValue:&value forKey:mapping.internalKey error:NULL];
 
+    // Intern what is actually stored, validation may have replaced the value. Scalar properties don't keep the boxed value at all.
+    if (!isCollection && [self internsValuesForMapping:mapping] && EFClassStoresObjectForKey([object class], mapping.internalKey)) {
+        value = [self internedValue:value mapping:mapping];
+    }
+
     [object setValue:value forKey:mapping.internalKey];
 }
 
+- (BOOL)internsValuesForMapping:(EFMapping *)mapping {
+    return self.interningPool && (mapping.interned || [self.internedClasses containsObject:mapping.internalClass]);
+}
+
+- (id)internedValue:(id)value mapping:(EFMapping *)mapping {
+    if (!value || ![self internsValuesForMapping:mapping]) {
+        return value;
+    }
+    return [self.interningPool internedValue:value];
+}
+
 #pragma mark - NSCoding support
 - (void)encodeObject:(id)object withCoder:(NSCoder *)aCoder {
     // Forward to registered mapper
@@ -513,25 +621,11 @@
 
 #pragma mark - Dictionary representation
 - (void)registerDictionaryRepresentationKeys:(NSArray *)keys forClass:(Class)aClass {
-    if (keys) {
-        self.dictionaryKeys[NSStringFromClass(aClass)] = keys;
-    } else {
-        [self.dictionaryKeys removeObjectForKey:NSStringFromClass(aClass)];
-    }
+    [self registerObject:keys inRegistry:self.dictionaryKeys forClass:aClass];
 }
 
 - (NSArray *)dictionaryRepresentationKeysForClass:(Class)aClass {
-    NSArray *dictionaryKeys = self.dictionaryKeys[NSStringFromClass(aClass)];
-    if (dictionaryKeys) {
-        return dictionaryKeys;
-    } else {
-        Class superClass = [aClass superclass];
-        if (superClass != Nil) {
-            return [self dictionaryRepresentationKeysForClass:superClass];
-        } else {
-            return nil;
-        }
-    }
+    return [self registeredObjectInRegistry:self.dictionaryKeys forClass:aClass resolve:YES];
 }
 
 - (id)dictionaryRepresentationOfObject:(id)object forKeys:(NSArray *)keys {
@@ -575,50 +669,7 @@
                     continue;
                 }
 
-                if (mapping.type == EFMappingTypeCollection) {
-                    if ([mapping.collectionClass isSubclassOfClass:[NSArray class]]) {
-                        NSArray *value = [object valueForKey:mapping.internalKey];
-                        NSMutableArray *dictionaryRepresentation = [NSMutableArray arrayWithCapacity:[value count]];
-                        for (__strong id child in value) {
-                            NSError *error = nil;
-                            child = [self transformValue:child mapping:mapping reverse:YES error:&error];
-                            if (child) {
-                                [dictionaryRepresentation addObject:[self dictionaryRepresentationOfObject:child]];
-                            } else {
-                                [dictionaryRepresentation addObject:[NSNull null]];
-                            }
-                        }
-                        dictionary[mapping.externalKey] = dictionaryRepresentation;
-                    } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]]) {
-                        NSDictionary *value = [object valueForKey:mapping.internalKey];
-                        NSMutableDictionary *dictionaryRepresentation = [NSMutableDictionary dictionaryWithCapacity:[value count]];
-                        [dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
-                            NSError *error = nil;
-                            child = [self transformValue:child mapping:mapping reverse:YES error:&error];
-                            if (child) {
-                                dictionaryRepresentation[key] = [self dictionaryRepresentationOfObject:child];
-                            } else {
-                                dictionaryRepresentation[key] = [NSNull null];
-                            }
-                        }];
-                        dictionary[mapping.externalKey] = dictionaryRepresentation;
-                    } else {
-                        continue;
-                    }
-                } else {
-                    id child = [object valueForKey:mapping.internalKey];
-                    if (child) {
-                        NSError *error = nil;
-                        child = [self transformValue:child mapping:mapping reverse:YES error:&error];
-                        if (object) {
-                            dictionary[mapping.externalKey] = [self dictionaryRepresentationOfObject:child];
-                        } else {
-                            dictionary[mapping.externalKey] = [NSNull null];
-                        }
-                    } else {
-                        dictionary[mapping.externalKey] = [NSNull null];
-                    }
-                }
+                [self addDictionaryRepresentationOfObject:object mapping:mapping toDictionary:dictionary];
             }
             return [dictionary copy];
         } else {
@@ -627,6 +678,53 @@
     }
 }
 
+- (void)addDictionaryRepresentationOfObject:(id)object mapping:(EFMapping *)mapping toDictionary:(NSMutableDictionary *)dictionary {
+    if (mapping.type == EFMappingTypeCollection) {
+        if ([mapping.collectionClass isSubclassOfClass:[NSArray class]]) {
+            NSArray *value = [object valueForKey:mapping.internalKey];
+            NSMutableArray *dictionaryRepresentation = [NSMutableArray arrayWithCapacity:[value count]];
+            for (__strong id child in value) {
+                NSError *error = nil;
+                child = [self transformValue:child mapping:mapping reverse:YES error:&error];
+                if (child) {
+                    [dictionaryRepresentation addObject:[self dictionaryRepresentationOfObject:child]];
+                } else {
+                    [dictionaryRepresentation addObject:[NSNull null]];
+                }
+            }
+            dictionary[mapping.externalKey] = dictionaryRepresentation;
+        } else if ([mapping.collectionClass isSubclassOfClass:[NSDictionary class]]) {
+            NSDictionary *value = [object valueForKey:mapping.internalKey];
+            NSMutableDictionary *dictionaryRepresentation = [NSMutableDictionary dictionaryWithCapacity:[value count]];
+            [dictionary enumerateKeysAndObjectsUsingBlock:^(id key, id child, BOOL *stop) {
+                NSError *error = nil;
+                child = [self transformValue:child mapping:mapping reverse:YES error:&error];
+                if (child) {
+                    dictionaryRepresentation[key] = [self dictionaryRepresentationOfObject:child];
+                } else {
+                    dictionaryRepresentation[key] = [NSNull null];
+                }
+            }];
+            dictionary[mapping.externalKey] = dictionaryRepresentation;
+        } else {
+            return;
+        }
+    } else {
+        id child = [object valueForKey:mapping.internalKey];
+        if (child) {
+            NSError *error = nil;
+            child = [self transformValue:child mapping:mapping reverse:YES error:&error];
+            if (object) {
+                dictionary[mapping.externalKey] = [self dictionaryRepresentationOfObject:child];
+            } else {
+                dictionary[mapping.externalKey] = [NSNull null];
+            }
+        } else {
+            dictionary[mapping.externalKey] = [NSNull null];
+        }
+    }
+}
+
 - (id)dictionaryRepresentationOfObject:(id)object {
     // Forward to registered mapper
     EFMapper *mapper = [self mapperForClass:[object class]];
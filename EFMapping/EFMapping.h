@@ -105,6 +105,13 @@ typedef void (^EFMappingFactoryBlock)(EFMapping *mapping);
  */
 @property (nonatomic, strong) id <EFRequires> requires;
 
+/**
+ *  Deduplicate values through the interning pool of the mapper before setting them on local entity
+ *
+ *  Only has effect if the mapper has an `interningPool`. Use this for values with few distinct values which are repeated often, such as status strings or country codes.
+ */
+@property (nonatomic, assign) BOOL interned;
+
 #pragma mark - Number (incl. BOOL, integer, floats etc.)
 /** @name Number (incl. BOOL, integer, floats etc.) */
 /**
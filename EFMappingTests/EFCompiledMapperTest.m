@@ -0,0 +1,213 @@
+//
+//  EFCompiledMapperTest.m
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#import "EFDataMappingKit.h"
+#import "EFMapper-Subclass.h"
+#import "EFCompiledSample.h"
+#import "EFMappingCodeGenerator.h"
+
+@interface EFCompiledSampleSubclass : EFCompiledSample
+
+@end
+
+@implementation EFCompiledSampleSubclass
+
+@end
+
+@interface EFCompiledMapperTest : XCTestCase
+
+@property (nonatomic, strong) EFMapper *interpretingMapper;
+@property (nonatomic, strong) EFMapper *compiledMapper;
+
+@end
+
+@implementation EFCompiledMapperTest
+
+- (void)setUp {
+    [super setUp];
+
+    self.interpretingMapper = [[EFMapper alloc] init];
+    EFCompiledSampleRegisterMappings(self.interpretingMapper);
+
+    self.compiledMapper = [[EFMapper alloc] init];
+    EFCompiledSampleRegisterMappings(self.compiledMapper);
+    EFRegisterCompiledSampleMappers(self.compiledMapper);
+}
+
+- (void)tearDown {
+    EFCompiledSampleCodingMapper = nil;
+    [super tearDown];
+}
+
+- (NSArray *)parityValues {
+    return @[@{@"id": @"1"},
+             @{@"id": @"1", @"type": @"foo", @"points": @12, @"score_value": @3.5, @"created_at": @"2014-04-01", @"status": @"active"},
+             @{@"id": @"1", @"type": @"bar", @"points": @0, @"score_value": [NSNull null], @"children": @[@{@"id": @"2", @"type": @"foo"}, @{@"id": @"3", @"children": @[@{@"id": @"4"}]}]},
+             @{@"id": @"1", @"type": @"unknown"},
+             @{@"id": @"1", @"type": @2},
+             @{@"id": @1},
+             @{@"id": [NSNull null]},
+             @{@"type": @"foo"},
+             @{@"id": @"1", @"points": @"12"},
+             @{@"id": @"1", @"points": @-1},
+             @{@"id": @"1", @"score_value": @"high"},
+             @{@"id": @"1", @"children": @[@{@"id": @2}, @{@"id": @"3", @"score_value": @"low"}]},
+             @{@"id": @" 5 "},
+             @{@"id": @"invalid"},
+             @{@"id": @"1", @"status": [NSNull null]},
+             @{@"id": @"1", @"status": @3},
+             @[]];
+}
+
+- (void)testCompiledMapperIsRegistered {
+    XCTAssertTrue([[self.compiledMapper mapperForClass:[EFCompiledSample class]] isKindOfClass:[EFCompiledMapper class]], @"Expected compiled mapper");
+    XCTAssertTrue([[self.interpretingMapper mapperForClass:[EFCompiledSample class]] isEqual:self.interpretingMapper], @"Expected interpreting mapper");
+}
+
+- (void)testChangedMappingsAreNotCompiled {
+    NSArray *mappings = [self.interpretingMapper mappingsForClass:[EFCompiledSample class]];
+    NSArray *reorderedMappings = [[mappings reverseObjectEnumerator] allObjects];
+    NSMutableArray *renamedMappings = [mappings mutableCopy];
+    renamedMappings[3] = [EFMapping mappingForNumberWithExternalKey:@"score" internalKey:@"score"];
+
+    for (NSArray *changedMappings in @[reorderedMappings, renamedMappings]) {
+        EFMapper *mapper = [[EFMapper alloc] init];
+        [mapper registerMappings:changedMappings forClass:[EFCompiledSample class]];
+        EFRegisterCompiledSampleMappers(mapper);
+
+        EFCompiledSample *sample = [mapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @"1", @"points": @3} error:NULL];
+        XCTAssertEqual(sample.points, (NSInteger)3, @"Expected changed mappings to be used");
+        XCTAssertEqual([(EFCompiledMapper *)[mapper mapperForClass:[EFCompiledSample class]] compiledClass], Nil, @"Expected compiled code not to be used for changed mappings");
+    }
+}
+
+- (void)testRegisteringDoesNotBuildMappings {
+    EFMapper *mapper = [[EFMapper alloc] init];
+    NSUInteger count = EFCompiledSampleMappingsCount;
+    EFRegisterCompiledSampleMappers(mapper);
+    XCTAssertEqual(EFCompiledSampleMappingsCount, count, @"Expected registering compiled mappers not to call +ef_mappings");
+
+    EFCompiledSample *sample = [mapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @"1", @"type": @"bar", @"points": @3} error:NULL];
+    XCTAssertEqual(EFCompiledSampleMappingsCount, count + 1, @"Expected +ef_mappings to be called on first use");
+    XCTAssertEqual([(EFCompiledMapper *)[mapper mapperForClass:[EFCompiledSample class]] compiledClass], [EFCompiledSample class], @"Expected compiled code to be used for mappings from +ef_mappings");
+    XCTAssertEqual(sample.type, EFCompiledSampleTypeBar, @"Expected compiled mapper to map values");
+    XCTAssertEqual(sample.points, (NSInteger)3, @"Expected compiled mapper to map values");
+}
+
+- (void)testValidationParity {
+    for (id values in [self parityValues]) {
+        NSError *interpretedError = nil;
+        NSError *compiledError = nil;
+        BOOL interpretedValid = [self.interpretingMapper validateValues:values forClass:[EFCompiledSample class] error:&interpretedError];
+        BOOL compiledValid = [self.compiledMapper validateValues:values forClass:[EFCompiledSample class] error:&compiledError];
+        XCTAssertEqual(interpretedValid, compiledValid, @"Validation differs for %@", values);
+        XCTAssertEqualObjects(EFPrettyMappingError(interpretedError), EFPrettyMappingError(compiledError), @"Validation error differs for %@", values);
+    }
+}
+
+- (void)testMappingParity {
+    for (id values in [self parityValues]) {
+        NSError *interpretedError = nil;
+        NSError *compiledError = nil;
+        EFCompiledSample *interpretedSample = [self.interpretingMapper objectOfClass:[EFCompiledSample class] withValues:values error:&interpretedError];
+        EFCompiledSample *compiledSample = [self.compiledMapper objectOfClass:[EFCompiledSample class] withValues:values error:&compiledError];
+        XCTAssertEqual(interpretedSample == nil, compiledSample == nil, @"Mapping differs for %@", values);
+        XCTAssertEqualObjects(EFPrettyMappingError(interpretedError), EFPrettyMappingError(compiledError), @"Mapping error differs for %@", values);
+        if (!interpretedSample || !compiledSample) {
+            continue;
+        }
+
+        XCTAssertEqualObjects(compiledSample.guid, interpretedSample.guid, @"guid differs for %@", values);
+        XCTAssertEqual(compiledSample.type, interpretedSample.type, @"type differs for %@", values);
+        XCTAssertEqual(compiledSample.points, interpretedSample.points, @"points differs for %@", values);
+        XCTAssertEqualObjects(compiledSample.score, interpretedSample.score, @"score differs for %@", values);
+        XCTAssertEqualObjects(compiledSample.creationDate, interpretedSample.creationDate, @"creationDate differs for %@", values);
+        XCTAssertEqual([compiledSample.children count], [interpretedSample.children count], @"children differ for %@", values);
+        XCTAssertEqualObjects(compiledSample.status, interpretedSample.status, @"status differs for %@", values);
+
+        id interpretedRepresentation = [self.interpretingMapper dictionaryRepresentationOfObject:interpretedSample];
+        id compiledRepresentation = [self.compiledMapper dictionaryRepresentationOfObject:compiledSample];
+        XCTAssertEqualObjects(compiledRepresentation, interpretedRepresentation, @"Dictionary representation differs for %@", values);
+
+        NSArray *keys = @[@"id", @"type", @"children"];
+        XCTAssertEqualObjects([self.compiledMapper dictionaryRepresentationOfObject:compiledSample forKeys:keys], [self.interpretingMapper dictionaryRepresentationOfObject:interpretedSample forKeys:keys], @"Partial dictionary representation differs for %@", values);
+    }
+}
+
+- (void)testCodingParity {
+    for (id values in [self parityValues]) {
+        EFCompiledSample *sample = [self.interpretingMapper objectOfClass:[EFCompiledSample class] withValues:values error:NULL];
+        if (!sample) {
+            continue;
+        }
+
+        // Encode with one, decode with the other
+        EFCompiledSampleCodingMapper = self.compiledMapper;
+        NSData *compiledData = [NSKeyedArchiver archivedDataWithRootObject:sample];
+        EFCompiledSampleCodingMapper = self.interpretingMapper;
+        EFCompiledSample *interpretedDecoded = [NSKeyedUnarchiver unarchiveObjectWithData:compiledData];
+        NSData *interpretedData = [NSKeyedArchiver archivedDataWithRootObject:sample];
+        EFCompiledSampleCodingMapper = self.compiledMapper;
+        EFCompiledSample *compiledDecoded = [NSKeyedUnarchiver unarchiveObjectWithData:interpretedData];
+
+        id expected = [self.interpretingMapper dictionaryRepresentationOfObject:sample];
+        XCTAssertEqualObjects([self.interpretingMapper dictionaryRepresentationOfObject:compiledDecoded], expected, @"Coding differs for %@", values);
+        XCTAssertEqualObjects([self.interpretingMapper dictionaryRepresentationOfObject:interpretedDecoded], expected, @"Coding differs for %@", values);
+    }
+}
+
+- (void)testKeyValueValidationOverride {
+    EFCompiledSample *sample = [self.compiledMapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @" 5 "} error:NULL];
+    XCTAssertEqualObjects(sample.guid, @"5", @"Expected value to be coerced by validateValue:forKey:error:");
+
+    NSError *error = nil;
+    EFCompiledSample *invalidSample = [self.compiledMapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @"invalid"} error:&error];
+    XCTAssertNil(invalidSample, @"Expected validateValue:forKey:error: to reject value");
+    XCTAssertEqualObjects([error.userInfo[EFMappingErrorValidationErrorsKey][@"guid"] localizedDescription], @"Guid is invalid", @"Expected validation error");
+}
+
+- (void)testInterningValidatedValues {
+    for (EFMapper *mapper in @[self.interpretingMapper, self.compiledMapper]) {
+        mapper.interningPool = [[EFInterningPool alloc] initWithCapacity:10];
+        mapper.internedClasses = [NSSet setWithObject:[NSString class]];
+
+        // Validation trims the guid into a new string, which is what should be shared
+        EFCompiledSample *sample = [mapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @" interned identifier "} error:NULL];
+        EFCompiledSample *otherSample = [mapper objectOfClass:[EFCompiledSample class] withValues:@{@"id": @"interned identifier  "} error:NULL];
+        XCTAssertEqualObjects(sample.guid, @"interned identifier", @"Expected value to be validated");
+        XCTAssertEqual(sample.guid, otherSample.guid, @"Expected validated values to be interned");
+    }
+}
+
+- (void)testSubclassesFallBackToMappings {
+    NSDictionary *values = @{@"id": @"1", @"type": @"bar", @"points": @7};
+    EFCompiledSampleSubclass *interpretedSample = [self.interpretingMapper objectOfClass:[EFCompiledSampleSubclass class] withValues:values error:NULL];
+    EFCompiledSampleSubclass *compiledSample = [self.compiledMapper objectOfClass:[EFCompiledSampleSubclass class] withValues:values error:NULL];
+    XCTAssertTrue([compiledSample isKindOfClass:[EFCompiledSampleSubclass class]], @"Expected subclass instance");
+    XCTAssertEqualObjects([self.compiledMapper dictionaryRepresentationOfObject:compiledSample], [self.interpretingMapper dictionaryRepresentationOfObject:interpretedSample], @"Dictionary representation differs for subclass");
+}
+
+- (void)testGeneratingSource {
+    EFMappingCodeGenerator *generator = [[EFMappingCodeGenerator alloc] initWithMapper:self.interpretingMapper];
+    generator.imports = @[@"EFCompiledSample.h"];
+    generator.registrationFunctionName = @"EFRegisterCompiledSampleMappers";
+    NSString *source = [generator sourceForClasses:@[[EFCompiledSample class]]];
+
+    // The parity tests run against the checked-in source, which must be what the generator produces now
+    NSString *path = [[@(__FILE__) stringByDeletingLastPathComponent] stringByAppendingPathComponent:@"EFCompiledSampleMapper.m"];
+    NSError *error = nil;
+    NSString *expectedSource = [NSString stringWithContentsOfFile:path encoding:NSUTF8StringEncoding error:&error];
+    XCTAssertNotNil(expectedSource, @"Could not read %@: %@", path, error);
+    XCTAssertEqualObjects(source, expectedSource, @"Generated source differs from EFCompiledSampleMapper.m, regenerate it with make sample in Tools/efmapgen");
+
+    XCTAssertEqualObjects([generator sourceForClasses:@[[EFCompiledSample class], [NSObject class]]], source, @"Expected classes without mappings to be skipped");
+}
+
+@end
@@ -0,0 +1,47 @@
+//
+//  EFCompiledSample.h
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFDataMappingKit.h"
+
+typedef NS_ENUM(int, EFCompiledSampleType) {
+    EFCompiledSampleTypeUnknown,
+    EFCompiledSampleTypeFoo,
+    EFCompiledSampleTypeBar
+};
+
+@interface EFCompiledSample : NSObject <NSCoding, EFMappable>
+
+@property (nonatomic, copy) NSString *guid;
+@property (nonatomic, assign) EFCompiledSampleType type;
+@property (nonatomic, assign) NSInteger points;
+@property (nonatomic, strong) NSNumber *score;
+@property (nonatomic, strong) NSDate *creationDate;
+@property (nonatomic, copy) NSArray *children;
+@property (nonatomic, copy, readonly) NSString *status;
+
+@end
+
+/**
+ *  Mapper used by `EFCompiledSample` to implement `NSCoding`
+ */
+extern EFMapper *EFCompiledSampleCodingMapper;
+
+/**
+ *  Number of times `+[EFCompiledSample ef_mappings]` was called
+ */
+extern NSUInteger EFCompiledSampleMappingsCount;
+
+/**
+ *  Registers the mappings of `EFCompiledSample`, from which EFCompiledSampleMapper.m is generated
+ */
+void EFCompiledSampleRegisterMappings(EFMapper *mapper);
+
+/**
+ *  Registers the generated mappers from EFCompiledSampleMapper.m
+ */
+void EFRegisterCompiledSampleMappers(EFMapper *mapper);
@@ -0,0 +1,90 @@
+//
+//  EFCompiledSample.m
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFCompiledSample.h"
+
+EFMapper *EFCompiledSampleCodingMapper = nil;
+NSUInteger EFCompiledSampleMappingsCount = 0;
+
+static NSArray *EFCompiledSampleMappings(void);
+
+@interface EFCompiledSample ()
+
+// Only settable in the class extension, so generated code can't rely on the header to call the setter
+@property (nonatomic, copy, readwrite) NSString *status;
+
+@end
+
+@implementation EFCompiledSample
+
++ (NSArray *)ef_mappings {
+    EFCompiledSampleMappingsCount++;
+    return EFCompiledSampleMappings();
+}
+
+- (id)initWithCoder:(NSCoder *)aDecoder {
+    self = [super init];
+    if (self) {
+        [EFCompiledSampleCodingMapper decodeObject:self withCoder:aDecoder];
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)aCoder {
+    [EFCompiledSampleCodingMapper encodeObject:self withCoder:aCoder];
+}
+
+- (BOOL)validateValue:(inout id *)ioValue forKey:(NSString *)inKey error:(out NSError **)outError {
+    // Validates as a whole, like NSManagedObject does, instead of through validate<Key>:error:
+    if ([inKey isEqualToString:@"guid"] && [*ioValue isKindOfClass:[NSString class]]) {
+        if ([*ioValue isEqualToString:@"invalid"]) {
+            if (outError != NULL) {
+                *outError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingRequirementsFailed userInfo:@{NSLocalizedDescriptionKey: @"Guid is invalid"}];
+            }
+            return NO;
+        }
+        *ioValue = [*ioValue stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceCharacterSet]];
+    }
+    return [super validateValue:ioValue forKey:inKey error:outError];
+}
+
+- (BOOL)validatePoints:(id *)ioValue error:(NSError **)outError {
+    if ([*ioValue isKindOfClass:[NSNumber class]] && [*ioValue integerValue] < 0) {
+        if (outError != NULL) {
+            *outError = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingRequirementsFailed userInfo:@{NSLocalizedDescriptionKey: @"Points can't be negative"}];
+        }
+        return NO;
+    }
+    return YES;
+}
+
+@end
+
+static NSArray *EFCompiledSampleMappings(void) {
+    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
+    [dateFormatter setDateFormat:@"yyyy-MM-dd"];
+    [dateFormatter setTimeZone:[NSTimeZone timeZoneWithAbbreviation:@"GMT"]];
+
+    return @[[EFMapping mapping:^(EFMapping *m){m.internalClass = [NSString class]; m.externalKey = @"id"; m.internalKey = @"guid"; m.requires = [EFRequires exists];}],
+             [EFMapping mapping:^(EFMapping *m){
+                  m.internalClass = [NSNumber class];
+                  m.key = @"type";
+                  m.transformer = [EFEnumTransformer transformerWithEnumMapping:@{@(EFCompiledSampleTypeFoo): @"foo",
+                                                                                  @(EFCompiledSampleTypeBar): @"bar"}];
+              }],
+             [EFMapping mappingForNumberWithKey:@"points"],
+             [EFMapping mappingForNumberWithExternalKey:@"score_value" internalKey:@"score"],
+             [EFMapping mapping:^(EFMapping *m){m.internalClass = [NSDate class]; m.externalKey = @"created_at"; m.internalKey = @"creationDate"; m.formatter = dateFormatter;}],
+             [EFMapping mappingForArrayOfClass:[EFCompiledSample class] key:@"children"],
+             [EFMapping mappingForStringWithKey:@"status"]
+             ];
+}
+
+void EFCompiledSampleRegisterMappings(EFMapper *mapper) {
+    [mapper registerMappings:EFCompiledSampleMappings() forClass:[EFCompiledSample class]];
+}
@@ -0,0 +1,301 @@
+//
+//  Generated by EFMappingCodeGenerator, do not edit.
+//
+
+#import "EFDataMappingKit.h"
+#import "EFMapper-Subclass.h"
+#import "EFCompiledMapper.h"
+#import "EFCompiledSample.h"
+
+#pragma mark - EFCompiledSample
+
+static NSNumber *EFGeneratedEFCompiledSample_type(id value) {
+    if ([value isEqual:@"bar"]) {
+        return @((NSInteger)2);
+    }
+    if ([value isEqual:@"foo"]) {
+        return @((NSInteger)1);
+    }
+    return @((NSInteger)0);
+}
+
+@class NSArray, NSDate, NSNumber, NSString;
+
+@interface EFCompiledSample (EFGeneratedAccessors)
+
+- (NSString *)guid;
+- (void)setGuid:(NSString *)guid;
+- (NSNumber *)score;
+- (void)setScore:(NSNumber *)score;
+- (NSDate *)creationDate;
+- (void)setCreationDate:(NSDate *)creationDate;
+- (NSArray *)children;
+- (void)setChildren:(NSArray *)children;
+- (NSString *)status;
+- (void)setStatus:(NSString *)status;
+
+@end
+
+@interface EFGeneratedEFCompiledSampleMapper : EFCompiledMapper
+
+@end
+
+@implementation EFGeneratedEFCompiledSampleMapper
+
+- (BOOL)validateValues:(NSDictionary *)values forClass:(Class)aClass onObject:(id)object error:(NSError **)error {
+    if (aClass != self.compiledClass || ![values isKindOfClass:[NSDictionary class]]) {
+        return [super validateValues:values forClass:aClass onObject:object error:error];
+    }
+
+    NSArray *mappings = self.compiledMappings;
+    NSMutableDictionary *errors = [NSMutableDictionary dictionary];
+    {
+        id value = values[@"id"];
+        id validatedValue = value;
+        if ([validatedValue isKindOfClass:[NSNull class]]) {
+            validatedValue = nil;
+        }
+        if (![[mappings[0] requires] evaluateForValue:validatedValue]) {
+            NSString *description = [NSString stringWithFormat:@"Did not pass requirements for value (%@) of class %@ for key guid", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"guid"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingRequirementsFailed userInfo:@{NSLocalizedDescriptionKey: description}];
+        } else if (validatedValue && ![validatedValue isKindOfClass:[NSString class]]) {
+            NSString *description = [NSString stringWithFormat:@"Did not expect value (%@) of class %@ for key guid but a NSString instance", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"guid"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        NSError *validationError;
+        if (object && ![object validateValue:&value forKey:@"guid" error:&validationError]) {
+            errors[@"guid"] = validationError;
+        }
+    }
+    {
+        id value = values[@"type"];
+        id validatedValue = EFGeneratedEFCompiledSample_type(value);
+        if ([validatedValue isKindOfClass:[NSNull class]]) {
+            validatedValue = nil;
+        }
+        if (validatedValue && ![validatedValue isKindOfClass:[NSNumber class]]) {
+            NSString *description = [NSString stringWithFormat:@"Did not expect value (%@) of class %@ for key type but a NSNumber instance", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"type"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        NSError *validationError;
+        if (object && ![object validateValue:&value forKey:@"type" error:&validationError]) {
+            errors[@"type"] = validationError;
+        }
+    }
+    {
+        id value = values[@"points"];
+        id validatedValue = value;
+        if ([validatedValue isKindOfClass:[NSNull class]]) {
+            validatedValue = nil;
+        }
+        if (validatedValue && ![validatedValue isKindOfClass:[NSNumber class]]) {
+            NSString *description = [NSString stringWithFormat:@"Did not expect value (%@) of class %@ for key points but a NSNumber instance", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"points"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        NSError *validationError;
+        if (object && ![object validateValue:&value forKey:@"points" error:&validationError]) {
+            errors[@"points"] = validationError;
+        }
+    }
+    {
+        id value = values[@"score_value"];
+        id validatedValue = value;
+        if ([validatedValue isKindOfClass:[NSNull class]]) {
+            validatedValue = nil;
+        }
+        if (validatedValue && ![validatedValue isKindOfClass:[NSNumber class]]) {
+            NSString *description = [NSString stringWithFormat:@"Did not expect value (%@) of class %@ for key score but a NSNumber instance", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"score"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        NSError *validationError;
+        if (object && ![object validateValue:&value forKey:@"score" error:&validationError]) {
+            errors[@"score"] = validationError;
+        }
+    }
+    [self validateValues:values mapping:mappings[4] onObject:object errors:errors];
+    [self validateValues:values mapping:mappings[5] onObject:object errors:errors];
+    {
+        id value = values[@"status"];
+        id validatedValue = value;
+        if ([validatedValue isKindOfClass:[NSNull class]]) {
+            validatedValue = nil;
+        }
+        if (validatedValue && ![validatedValue isKindOfClass:[NSString class]]) {
+            NSString *description = [NSString stringWithFormat:@"Did not expect value (%@) of class %@ for key status but a NSString instance", validatedValue, NSStringFromClass([validatedValue class])];
+            errors[@"status"] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];
+        }
+        NSError *validationError;
+        if (object && ![object validateValue:&value forKey:@"status" error:&validationError]) {
+            errors[@"status"] = validationError;
+        }
+    }
+    return [self validationResultWithErrors:errors forClass:aClass error:error];
+}
+
+- (BOOL)setValues:(NSDictionary *)values onObject:(id)object error:(NSError **)error {
+    if ([object class] != self.compiledClass) {
+        return [super setValues:values onObject:object error:error];
+    }
+
+    if (![self validateValues:values onObject:object error:error]) {
+        return NO;
+    }
+
+    NSArray *mappings = self.compiledMappings;
+    {
+        id value = values[@"id"];
+        if (value) {
+            if ([value isKindOfClass:[NSNull class]]) {
+                value = nil;
+            }
+            [object validateValue:&value forKey:@"guid" error:NULL];
+            value = [self internedValue:value mapping:mappings[0]];
+            [(EFCompiledSample *)object setGuid:value];
+        }
+    }
+    {
+        id value = EFGeneratedEFCompiledSample_type(values[@"type"]);
+        if (value) {
+            if ([value isKindOfClass:[NSNull class]]) {
+                value = nil;
+            }
+            [object validateValue:&value forKey:@"type" error:NULL];
+            [object setValue:value forKey:@"type"];
+        }
+    }
+    {
+        id value = values[@"points"];
+        if (value) {
+            if ([value isKindOfClass:[NSNull class]]) {
+                value = nil;
+            }
+            [object validateValue:&value forKey:@"points" error:NULL];
+            [object setValue:value forKey:@"points"];
+        }
+    }
+    {
+        id value = values[@"score_value"];
+        if (value) {
+            if ([value isKindOfClass:[NSNull class]]) {
+                value = nil;
+            }
+            [object validateValue:&value forKey:@"score" error:NULL];
+            value = [self internedValue:value mapping:mappings[3]];
+            [(EFCompiledSample *)object setScore:value];
+        }
+    }
+    [self setValues:values onObject:object mapping:mappings[4] error:error];
+    [self setValues:values onObject:object mapping:mappings[5] error:error];
+    {
+        id value = values[@"status"];
+        if (value) {
+            if ([value isKindOfClass:[NSNull class]]) {
+                value = nil;
+            }
+            [object validateValue:&value forKey:@"status" error:NULL];
+            value = [self internedValue:value mapping:mappings[6]];
+            [(EFCompiledSample *)object setStatus:value];
+        }
+    }
+    return YES;
+}
+
+- (void)encodeObject:(id)object withCoder:(NSCoder *)aCoder {
+    if ([object class] != self.compiledClass) {
+        return [super encodeObject:object withCoder:aCoder];
+    }
+
+    [aCoder encodeObject:[(EFCompiledSample *)object guid] forKey:@"guid"];
+    [aCoder encodeObject:[object valueForKey:@"type"] forKey:@"type"];
+    [aCoder encodeObject:[object valueForKey:@"points"] forKey:@"points"];
+    [aCoder encodeObject:[(EFCompiledSample *)object score] forKey:@"score"];
+    [aCoder encodeObject:[(EFCompiledSample *)object creationDate] forKey:@"creationDate"];
+    [aCoder encodeObject:[(EFCompiledSample *)object children] forKey:@"children"];
+    [aCoder encodeObject:[(EFCompiledSample *)object status] forKey:@"status"];
+}
+
+- (void)decodeObject:(id)object withCoder:(NSCoder *)aDecoder {
+    if ([object class] != self.compiledClass) {
+        return [super decodeObject:object withCoder:aDecoder];
+    }
+
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSString class] forKey:@"guid"];
+        [(EFCompiledSample *)object setGuid:value];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSNumber class] forKey:@"type"];
+        [object setValue:value forKey:@"type"];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSNumber class] forKey:@"points"];
+        [object setValue:value forKey:@"points"];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSNumber class] forKey:@"score"];
+        [(EFCompiledSample *)object setScore:value];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSDate class] forKey:@"creationDate"];
+        [(EFCompiledSample *)object setCreationDate:value];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSArray class] forKey:@"children"];
+        [(EFCompiledSample *)object setChildren:value];
+    }
+    {
+        id value = [aDecoder decodeObjectOfClass:[NSString class] forKey:@"status"];
+        [(EFCompiledSample *)object setStatus:value];
+    }
+}
+
+- (id)dictionaryRepresentationOfObject:(id)object forKeys:(NSArray *)keys {
+    if ([object class] != self.compiledClass) {
+        return [super dictionaryRepresentationOfObject:object forKeys:keys];
+    }
+
+    NSArray *mappings = self.compiledMappings;
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    if (!keys || [keys containsObject:@"id"]) {
+        id child = [(EFCompiledSample *)object guid];
+        dictionary[@"id"] = child ?: [NSNull null];
+    }
+    if (!keys || [keys containsObject:@"type"]) {
+        id child = [object valueForKey:@"type"];
+        dictionary[@"type"] = child ? EFGeneratedEFCompiledSample_type(child) : [NSNull null];
+    }
+    if (!keys || [keys containsObject:@"points"]) {
+        id child = [object valueForKey:@"points"];
+        dictionary[@"points"] = child ?: [NSNull null];
+    }
+    if (!keys || [keys containsObject:@"score_value"]) {
+        id child = [(EFCompiledSample *)object score];
+        dictionary[@"score_value"] = child ?: [NSNull null];
+    }
+    if (!keys || [keys containsObject:@"created_at"]) {
+        [self addDictionaryRepresentationOfObject:object mapping:mappings[4] toDictionary:dictionary];
+    }
+    if (!keys || [keys containsObject:@"children"]) {
+        [self addDictionaryRepresentationOfObject:object mapping:mappings[5] toDictionary:dictionary];
+    }
+    if (!keys || [keys containsObject:@"status"]) {
+        id child = [(EFCompiledSample *)object status];
+        dictionary[@"status"] = child ?: [NSNull null];
+    }
+    return [dictionary copy];
+}
+
+@end
+
+#pragma mark - Registration
+void EFRegisterCompiledSampleMappers(EFMapper *mapper) {
+    [EFGeneratedEFCompiledSampleMapper registerWithMapper:mapper forClass:[EFCompiledSample class] fingerprints:@[
+        @"id -> guid: NSString, requires",
+        @"type -> type: NSNumber, transformer EFEnumTransformer {1 = foo, 2 = bar}",
+        @"points -> points: NSNumber",
+        @"score_value -> score: NSNumber",
+        @"created_at -> creationDate: NSDate, formatter",
+        @"children -> children: NSArray of EFCompiledSample",
+        @"status -> status: NSString"
+    ]];
+}
@@ -8,6 +8,8 @@
 
 #import <XCTest/XCTest.h>
 
+#import <objc/runtime.h>
+
 #import "EFDataMappingKit.h"
 
 typedef NS_ENUM(int, EFSampleType) {
@@ -54,6 +56,96 @@ typedef NS_ENUM(int, EFSampleType) {
 
 @end
 
+static NSArray *EFSampleMappings(void) {
+    NSDateFormatter *dateFormatter = [[NSDateFormatter alloc] init];
+    [dateFormatter setDateFormat:@"yyyy-MM-dd"];
+
+    return @[[EFMapping mapping:^(EFMapping *m){m.internalClass = [NSString class]; m.externalKey = @"id"; m.internalKey = @"guid"; m.requires = [EFRequires exists];}],
+             [EFMapping mapping:^(EFMapping *m){
+                 m.internalClass = [NSNumber class];
+                 m.key = @"type";
+                 m.transformer = [EFEnumTransformer transformerWithEnumMapping:@{@(EFSampleTypeFoo): @"foo",
+                                                                                 @(EFSampleTypeBar): @"bar",
+                                                                                 @(EFSampleTypeBaz): @"baz"}];
+             }],
+             [EFMapping mappingForNumberWithExternalKey:@"points" internalKey:@"myPoints"],
+             [EFMapping mapping:^(EFMapping *m){m.internalClass = [NSDate class]; m.externalKey = @"created_at"; m.internalKey = @"creationDate"; m.formatter = dateFormatter;}],
+             [EFMapping mappingForClass:[EFSample class] key:@"sample"],
+             [EFMapping mappingForArrayOfClass:[EFSample class] externalKey:@"children" internalKey:@"relatedSamples"]];
+}
+
+static NSUInteger EFLazySampleMappingsCount = 0;
+
+@interface EFLazySample : EFSample <EFMappable>
+
+@end
+
+@implementation EFLazySample
+
++ (NSArray *)ef_mappings {
+    // Concurrent lookups may ask more than once, see EFMappable
+    __sync_fetch_and_add(&EFLazySampleMappingsCount, 1);
+    return EFSampleMappings();
+}
+
++ (EFMappingInitializerBlock)ef_initializer {
+    return ^id(Class aClass, NSDictionary *values) {
+        return [[aClass alloc] initCustomized];
+    };
+}
+
++ (NSArray *)ef_dictionaryRepresentationKeys {
+    return @[@"id"];
+}
+
+@end
+
+@interface EFLazySampleSubclass : EFLazySample
+
+@end
+
+@implementation EFLazySampleSubclass
+
+@end
+
+@interface EFLazyDispatchingSample : EFSample <EFMappable>
+
+@end
+
+@implementation EFLazyDispatchingSample
+
++ (NSArray *)ef_mappings {
+    dispatch_sync(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        [[EFMapper sharedInstance] mappingsForClass:[EFSample class]];
+    });
+    return @[[EFMapping mappingForStringWithExternalKey:@"id" internalKey:@"guid"]];
+}
+
+@end
+
+/**
+ *  Model set of 500 classes providing their mappings lazily, to measure launch time
+ */
+static NSArray *EFLazyModelClasses(void) {
+    static NSArray *classes = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        NSMutableArray *modelClasses = [NSMutableArray arrayWithCapacity:500];
+        for (NSUInteger i = 0; i < 500; i++) {
+            NSString *className = [NSString stringWithFormat:@"EFLazyModel%lu", (unsigned long)i];
+            Class aClass = objc_allocateClassPair([EFSample class], [className UTF8String], 0);
+            IMP implementation = imp_implementationWithBlock(^NSArray *(id self) {
+                return EFSampleMappings();
+            });
+            class_addMethod(object_getClass(aClass), @selector(ef_mappings), implementation, "@@:");
+            objc_registerClassPair(aClass);
+            [modelClasses addObject:aClass];
+        }
+        classes = [modelClasses copy];
+    });
+    return classes;
+}
+
 @interface EFMappingTest : XCTestCase
 
 @end
@@ -266,4 +358,155 @@ typedef NS_ENUM(int, EFSampleType) {
     XCTAssertEqual(sample.type, EFSampleTypeFoo, @"Expected type to be foo");
 }
 
+- (void)testInterningValues {
+    EFMapper *mapper = [[EFMapper alloc] init];
+    mapper.interningPool = [[EFInterningPool alloc] initWithCapacity:2];
+    [mapper registerMappings:@[[EFMapping mapping:^(EFMapping *m){m.internalClass = [NSString class]; m.externalKey = @"id"; m.internalKey = @"guid"; m.interned = YES;}],
+                               [EFMapping mappingForArrayOfClass:[EFSample class] externalKey:@"children" internalKey:@"relatedSamples"]] forClass:[EFSample class]];
+
+    // Long enough to never be a tagged pointer
+    NSString *guid1 = [NSMutableString stringWithString:@"a-rather-long-identifier-that-repeats"];
+    NSString *guid2 = [NSMutableString stringWithString:@"a-rather-long-identifier-that-repeats"];
+    XCTAssertFalse(guid1 == guid2, @"Expected distinct instances");
+
+    NSError *error;
+    EFSample *sample = [mapper objectOfClass:[EFSample class] withValues:@{@"id": guid1, @"children": @[@{@"id": guid2}]} error:&error];
+    XCTAssertNotNil(sample, @"Map error: %@", EFPrettyMappingError(error));
+    EFSample *child = [sample.relatedSamples firstObject];
+    XCTAssertEqualObjects(sample.guid, guid1, @"Expected interned value to be equal");
+    XCTAssertTrue(sample.guid == child.guid, @"Expected equal values to share one instance");
+    XCTAssertEqual(mapper.interningPool.count, (NSUInteger)1, @"Expected one value in pool");
+    XCTAssertTrue(mapper.interningPool.savedBytes > 0, @"Expected some bytes to be saved");
+
+    // Bounded
+    [mapper.interningPool internedValue:@"second"];
+    NSString *third = [NSMutableString stringWithString:@"third"];
+    XCTAssertEqualObjects([mapper.interningPool internedValue:third], third, @"Expected full pool to evict a value");
+    XCTAssertEqual(mapper.interningPool.count, (NSUInteger)2, @"Expected pool to be bounded");
+
+    // Numbers of different types are not shared
+    [mapper.interningPool removeAllValues];
+    NSNumber *one = [mapper.interningPool internedValue:@1];
+    XCTAssertTrue([mapper.interningPool internedValue:@YES] != one, @"Expected BOOL not to be replaced by integer");
+}
+
+- (void)testInterningRepeatedValuesInFullPool {
+    EFInterningPool *pool = [[EFInterningPool alloc] initWithCapacity:4];
+    for (NSUInteger i = 0; i < 4; i++) {
+        [pool internedValue:[NSString stringWithFormat:@"identifier-%lu", (unsigned long)i]];
+    }
+    XCTAssertEqual(pool.count, (NSUInteger)4, @"Expected pool to be full");
+
+    // Unique identifiers keep coming, the repeated status should stay shared
+    NSString *status = [pool internedValue:[NSMutableString stringWithString:@"a-rather-long-status-that-repeats"]];
+    for (NSUInteger i = 4; i < 100; i++) {
+        [pool internedValue:[NSString stringWithFormat:@"identifier-%lu", (unsigned long)i]];
+        NSString *repeatedStatus = [pool internedValue:[NSMutableString stringWithString:@"a-rather-long-status-that-repeats"]];
+        XCTAssertTrue(repeatedStatus == status, @"Expected repeated value to stay in full pool");
+    }
+    XCTAssertEqual(pool.count, (NSUInteger)4, @"Expected pool to be bounded");
+}
+
+- (void)testInterningValuesForInternalClasses {
+    EFMapper *mapper = [[EFMapper alloc] init];
+    mapper.interningPool = [[EFInterningPool alloc] init];
+    [mapper registerMappings:@[[EFMapping mappingForStringWithExternalKey:@"id" internalKey:@"guid"]] forClass:[EFSample class]];
+
+    NSString *guid1 = [NSMutableString stringWithString:@"a-rather-long-identifier-that-repeats"];
+    NSString *guid2 = [NSMutableString stringWithString:@"a-rather-long-identifier-that-repeats"];
+
+    EFSample *sample1 = [mapper objectOfClass:[EFSample class] withValues:@{@"id": guid1} error:NULL];
+    EFSample *sample2 = [mapper objectOfClass:[EFSample class] withValues:@{@"id": guid2} error:NULL];
+    XCTAssertFalse(sample1.guid == sample2.guid, @"Expected no interning without opting in");
+
+    mapper.internedClasses = [NSSet setWithObjects:[NSString class], [NSNumber class], nil];
+    sample1 = [mapper objectOfClass:[EFSample class] withValues:@{@"id": guid1} error:NULL];
+    sample2 = [mapper objectOfClass:[EFSample class] withValues:@{@"id": guid2} error:NULL];
+    XCTAssertTrue(sample1.guid == sample2.guid, @"Expected interning for internal class NSString");
+}
+
+- (void)testInterningSkipsScalarProperties {
+    EFMapper *mapper = [[EFMapper alloc] init];
+    mapper.interningPool = [[EFInterningPool alloc] init];
+    mapper.internedClasses = [NSSet setWithObject:[NSNumber class]];
+    [mapper registerMappings:@[[EFMapping mappingForStringWithExternalKey:@"id" internalKey:@"guid"],
+                               [EFMapping mappingForNumberWithExternalKey:@"points" internalKey:@"myPoints"]] forClass:[EFSample class]];
+
+    EFSample *sample = [mapper objectOfClass:[EFSample class] withValues:@{@"id": @"1", @"points": @42} error:NULL];
+    XCTAssertEqual(sample.myPoints, (NSInteger)42, @"Expected value to be set");
+    XCTAssertEqual(mapper.interningPool.count, (NSUInteger)0, @"Expected no interning for scalar property");
+}
+
+- (void)testLazyMappings {
+    EFLazySampleMappingsCount = 0;
+    EFMapper *mapper = [[EFMapper alloc] init];
+    XCTAssertEqual(EFLazySampleMappingsCount, (NSUInteger)0, @"Expected mappings not to be requested before use");
+
+    NSDictionary *values = @{@"id": @"1", @"type": @"bar"};
+    NSMutableArray *samples = [NSMutableArray array];
+    dispatch_apply(16, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        EFLazySample *sample = [mapper objectOfClass:[EFLazySample class] withValues:values error:NULL];
+        @synchronized(samples) {
+            [samples addObject:sample ?: [NSNull null]];
+        }
+    });
+    // Threads racing on first use may each ask, but they all use the same mappings
+    NSUInteger mappingsCount = EFLazySampleMappingsCount;
+    XCTAssertTrue(mappingsCount >= 1, @"Expected mappings to be requested");
+    for (EFLazySample *sample in samples) {
+        XCTAssertEqualObjects(sample.guid, @"1", @"Expected guid to be mapped on every thread");
+    }
+
+    EFLazySample *sample = [samples firstObject];
+    XCTAssertTrue([sample isKindOfClass:[EFLazySample class]], @"Expected sample");
+    XCTAssertEqualObjects(sample.guid, @"1", @"Expected guid to be mapped");
+    XCTAssertEqual(sample.type, EFSampleTypeBar, @"Expected type to be mapped");
+    XCTAssertTrue(sample.customInit, @"Expected lazy initializer to be used");
+    XCTAssertEqualObjects([mapper dictionaryRepresentationOfObject:sample], @{@"id": @"1"}, @"Expected lazy dictionary representation keys to be used");
+
+    // Subclasses inherit without asking again
+    EFLazySampleSubclass *subclassSample = [mapper objectOfClass:[EFLazySampleSubclass class] withValues:values error:NULL];
+    XCTAssertEqualObjects(subclassSample.guid, @"1", @"Expected guid to be mapped for subclass");
+    XCTAssertEqual(EFLazySampleMappingsCount, mappingsCount, @"Expected mappings not to be requested again");
+}
+
+- (void)testLazyMappingsUsingMapper {
+    // Would deadlock if the mapper held its lock while asking the class
+    NSArray *mappings = [[EFMapper sharedInstance] mappingsForClass:[EFLazyDispatchingSample class]];
+    XCTAssertEqual([mappings count], (NSUInteger)1, @"Expected lazy mappings");
+}
+
+- (void)testExplicitMappingsTakePrecedence {
+    EFLazySampleMappingsCount = 0;
+    EFMapper *mapper = [[EFMapper alloc] init];
+    [mapper registerMappings:@[[EFMapping mappingForStringWithExternalKey:@"identifier" internalKey:@"guid"]] forClass:[EFLazySample class]];
+
+    EFLazySample *sample = [mapper objectOfClass:[EFLazySample class] withValues:@{@"identifier": @"1"} error:NULL];
+    XCTAssertEqualObjects(sample.guid, @"1", @"Expected explicit mappings to be used");
+    XCTAssertEqual(EFLazySampleMappingsCount, (NSUInteger)0, @"Expected lazy mappings not to be requested");
+}
+
+- (void)testEagerRegistrationPerformance {
+    NSArray *classes = EFLazyModelClasses();
+    [self measureBlock:^{
+        EFMapper *mapper = [[EFMapper alloc] init];
+        for (Class aClass in classes) {
+            [mapper registerMappings:EFSampleMappings() forClass:aClass];
+        }
+        for (NSUInteger i = 0; i < 10; i++) {
+            [mapper objectOfClass:classes[i] withValues:@{@"id": @"1", @"created_at": @"2014-04-01"} error:NULL];
+        }
+    }];
+}
+
+- (void)testLazyRegistrationPerformance {
+    NSArray *classes = EFLazyModelClasses();
+    [self measureBlock:^{
+        EFMapper *mapper = [[EFMapper alloc] init];
+        for (NSUInteger i = 0; i < 10; i++) {
+            [mapper objectOfClass:classes[i] withValues:@{@"id": @"1", @"created_at": @"2014-04-01"} error:NULL];
+        }
+    }];
+}
+
 @end
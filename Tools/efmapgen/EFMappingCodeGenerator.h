@@ -0,0 +1,59 @@
+//
+//  EFMappingCodeGenerator.h
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class EFMapper;
+
+/**
+ *  `EFMappingCodeGenerator` generates Objective-C source for `EFCompiledMapper` subclasses from the mappings registered on a mapper.
+ *
+ *  The generated mappers validate, set, encode, decode and represent values with direct property access instead of interpreting the mappings at runtime. Object properties are accessed through their accessors, which the generated source declares in a category, so properties that are readonly in the header or private to the class work too. Primitive properties are accessed through key value coding. String and number mappings without formatter or transformation block are fully specialized, including inlined tables for `EFEnumTransformer` instances. Any other mapping is handed to the regular mapping code, one mapping at a time.
+ *
+ *  The generated source defines a registration function which registers all generated mappers on a mapper. Each mapper is only used if the mappings still match the ones it was generated from, see `-[EFCompiledMapper initWithMapper:forClass:fingerprints:]`. Regenerate the source whenever the mappings change.
+ */
+@interface EFMappingCodeGenerator : NSObject
+
+/**
+ *  Creates a code generator
+ *
+ *  @param mapper The mapper holding the mappings to generate code for
+ *
+ *  @return `EFMappingCodeGenerator` instance
+ */
+- (instancetype)initWithMapper:(EFMapper *)mapper;
+
+/**
+ *  The mapper holding the mappings to generate code for
+ */
+@property (nonatomic, strong, readonly) EFMapper *mapper;
+
+/**
+ *  Name of the generated registration function, defaults to `EFRegisterGeneratedMappers`
+ *
+ *  The function has the signature `void EFRegisterGeneratedMappers(EFMapper *mapper)`.
+ */
+@property (nonatomic, copy) NSString *registrationFunctionName;
+
+/**
+ *  Headers imported by the generated source, such as the headers declaring the classes
+ */
+@property (nonatomic, copy) NSArray *imports;
+
+/**
+ *  Generates source for compiled mappers
+ *
+ *  Classes without mappings are skipped.
+ *
+ *  @param classes Array of classes to generate mappers for
+ *
+ *  @return Objective-C source
+ */
+- (NSString *)sourceForClasses:(NSArray *)classes;
+
+@end
@@ -0,0 +1,469 @@
+//
+//  EFMappingCodeGenerator.m
+//  EFDataMappingKit
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+
+#import "EFMappingCodeGenerator.h"
+
+#import <objc/runtime.h>
+
+#import "EFMapper-Subclass.h"
+#import "EFCompiledMapper.h"
+#import "EFMapping-Private.h"
+#import "EFEnumTransformer.h"
+
+static NSString *EFStringLiteral(NSString *string) {
+    NSMutableString *literal = [string mutableCopy];
+    [literal replaceOccurrencesOfString:@"\\" withString:@"\\\\" options:0 range:NSMakeRange(0, [literal length])];
+    [literal replaceOccurrencesOfString:@"\"" withString:@"\\\"" options:0 range:NSMakeRange(0, [literal length])];
+    [literal replaceOccurrencesOfString:@"\n" withString:@"\\n" options:0 range:NSMakeRange(0, [literal length])];
+    [literal replaceOccurrencesOfString:@"\r" withString:@"\\r" options:0 range:NSMakeRange(0, [literal length])];
+    [literal replaceOccurrencesOfString:@"\t" withString:@"\\t" options:0 range:NSMakeRange(0, [literal length])];
+    return [NSString stringWithFormat:@"@\"%@\"", literal];
+}
+
+static NSString *EFIdentifier(NSString *string) {
+    NSMutableString *identifier = [NSMutableString stringWithCapacity:[string length]];
+    NSCharacterSet *allowed = [NSCharacterSet characterSetWithCharactersInString:@"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"];
+    for (NSUInteger i = 0; i < [string length]; i++) {
+        unichar character = [string characterAtIndex:i];
+        [identifier appendFormat:@"%C", [allowed characterIsMember:character] ? character : (unichar)'_'];
+    }
+    return identifier;
+}
+
+/**
+ *  Type encodings of primitive types key value coding boxes as `NSNumber`
+ */
+static NSSet *EFPrimitiveTypeEncodings(void) {
+    static NSSet *encodings = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        encodings = [NSSet setWithObjects:@"c", @"s", @"i", @"l", @"q", @"C", @"S", @"I", @"L", @"Q", @"f", @"d", @"B", nil];
+    });
+    return encodings;
+}
+
+/**
+ *  Describes how the property behind a mapping can be accessed directly
+ */
+@interface EFGeneratedProperty : NSObject
+
+@property (nonatomic, copy) NSString *key;
+@property (nonatomic, copy) NSString *className;
+@property (nonatomic, copy) NSString *type;
+@property (nonatomic, assign) Class objectClass;
+@property (nonatomic, assign) BOOL gettable;
+@property (nonatomic, assign) BOOL settable;
+
+@end
+
+@implementation EFGeneratedProperty
+
++ (instancetype)propertyForClass:(Class)aClass key:(NSString *)key {
+    objc_property_t property = class_getProperty(aClass, [key UTF8String]);
+    if (!property) {
+        return nil;
+    }
+
+    EFGeneratedProperty *generatedProperty = [[self alloc] init];
+    generatedProperty.key = key;
+    generatedProperty.className = NSStringFromClass(aClass);
+    generatedProperty.gettable = YES;
+    generatedProperty.settable = YES;
+
+    NSArray *attributes = [[NSString stringWithUTF8String:property_getAttributes(property)] componentsSeparatedByString:@","];
+    for (NSString *attribute in attributes) {
+        if ([attribute hasPrefix:@"T@\""]) {
+            NSString *objectClassName = [attribute substringWithRange:NSMakeRange(3, [attribute length] - 4)];
+            generatedProperty.type = @"@";
+            generatedProperty.objectClass = NSClassFromString(objectClassName);
+        } else if ([attribute hasPrefix:@"T"]) {
+            generatedProperty.type = [attribute substringFromIndex:1];
+        } else if ([attribute isEqualToString:@"R"] || [attribute hasPrefix:@"S"]) {
+            // KVC only uses the default setter
+            generatedProperty.settable = NO;
+        } else if ([attribute hasPrefix:@"G"]) {
+            // KVC only uses the default getter
+            generatedProperty.gettable = NO;
+        }
+    }
+    return generatedProperty;
+}
+
+- (BOOL)isPrimitive {
+    return [EFPrimitiveTypeEncodings() containsObject:self.type];
+}
+
+- (BOOL)isObject {
+    return [self.type isEqualToString:@"@"] && self.objectClass != Nil;
+}
+
+- (NSString *)setterName {
+    return [NSString stringWithFormat:@"set%@%@:", [[self.key substringToIndex:1] uppercaseString], [self.key substringFromIndex:1]];
+}
+
+- (NSArray *)accessorDeclarations {
+    // The accessors may be declared in a class extension or not at all, so the generated source declares the ones it calls. Primitives go through key value coding, as their declared C type can't be told from the type encoding.
+    if (![self isObject]) {
+        return @[];
+    }
+    NSString *objectClassName = NSStringFromClass(self.objectClass);
+    NSMutableArray *declarations = [NSMutableArray arrayWithCapacity:2];
+    if (self.gettable) {
+        [declarations addObject:[NSString stringWithFormat:@"- (%@ *)%@;", objectClassName, self.key]];
+    }
+    if (self.settable) {
+        [declarations addObject:[NSString stringWithFormat:@"- (void)%@(%@ *)%@;", [self setterName], objectClassName, self.key]];
+    }
+    return declarations;
+}
+
+- (NSString *)getterExpression {
+    if (self.gettable && [self isObject]) {
+        return [NSString stringWithFormat:@"[(%@ *)object %@]", self.className, self.key];
+    } else {
+        return [NSString stringWithFormat:@"[object valueForKey:%@]", EFStringLiteral(self.key)];
+    }
+}
+
+- (NSString *)setterStatementForValue:(NSString *)value indent:(NSString *)indent {
+    if (self.settable && [self isObject]) {
+        return [NSString stringWithFormat:@"%@[(%@ *)object %@%@];\n", indent, self.className, [self setterName], value];
+    } else {
+        return [NSString stringWithFormat:@"%@[object setValue:%@ forKey:%@];\n", indent, value, EFStringLiteral(self.key)];
+    }
+}
+
+@end
+
+@interface EFMappingCodeGenerator ()
+
+@property (nonatomic, strong, readwrite) EFMapper *mapper;
+
+@end
+
+@implementation EFMappingCodeGenerator
+
+- (instancetype)initWithMapper:(EFMapper *)mapper {
+    NSParameterAssert(mapper);
+    self = [super init];
+    if (self) {
+        _mapper = mapper;
+        _registrationFunctionName = @"EFRegisterGeneratedMappers";
+    }
+    return self;
+}
+
+- (NSString *)sourceForClasses:(NSArray *)classes {
+    NSMutableString *source = [NSMutableString string];
+    [source appendString:@"//\n"];
+    [source appendString:@"//  Generated by EFMappingCodeGenerator, do not edit.\n"];
+    [source appendString:@"//\n\n"];
+    [source appendString:@"#import \"EFDataMappingKit.h\"\n"];
+    [source appendString:@"#import \"EFMapper-Subclass.h\"\n"];
+    [source appendString:@"#import \"EFCompiledMapper.h\"\n"];
+    for (NSString *import in self.imports) {
+        [source appendFormat:@"#import \"%@\"\n", import];
+    }
+
+    NSMutableString *registration = [NSMutableString string];
+    [registration appendFormat:@"void %@(EFMapper *mapper) {\n", self.registrationFunctionName];
+    for (Class aClass in classes) {
+        NSArray *mappings = [self.mapper mappingsForClass:aClass];
+        if ([mappings count] == 0) {
+            continue;
+        }
+
+        [source appendString:[self sourceForClass:aClass mappings:mappings]];
+
+        NSString *className = NSStringFromClass(aClass);
+        NSMutableArray *fingerprints = [NSMutableArray arrayWithCapacity:[mappings count]];
+        for (NSString *fingerprint in [EFCompiledMapper fingerprintsForMappings:mappings]) {
+            [fingerprints addObject:[NSString stringWithFormat:@"        %@", EFStringLiteral(fingerprint)]];
+        }
+        [registration appendFormat:@"    [EFGenerated%@Mapper registerWithMapper:mapper forClass:[%@ class] fingerprints:@[\n", EFIdentifier(className), className];
+        [registration appendFormat:@"%@\n", [fingerprints componentsJoinedByString:@",\n"]];
+        [registration appendString:@"    ]];\n"];
+    }
+    [registration appendString:@"}\n"];
+
+    [source appendFormat:@"\n#pragma mark - Registration\n%@", registration];
+    return source;
+}
+
+#pragma mark - Classes
+- (NSString *)sourceForClass:(Class)aClass mappings:(NSArray *)mappings {
+    NSString *className = NSStringFromClass(aClass);
+    NSString *mapperName = [NSString stringWithFormat:@"EFGenerated%@Mapper", EFIdentifier(className)];
+
+    NSMutableString *functions = [NSMutableString string];
+    NSMutableString *validation = [NSMutableString string];
+    NSMutableString *setting = [NSMutableString string];
+    NSMutableString *encoding = [NSMutableString string];
+    NSMutableString *decoding = [NSMutableString string];
+    NSMutableString *representation = [NSMutableString string];
+    NSMutableOrderedSet *declarations = [NSMutableOrderedSet orderedSet];
+    NSMutableSet *declaredClassNames = [NSMutableSet set];
+
+    [mappings enumerateObjectsUsingBlock:^(EFMapping *mapping, NSUInteger idx, BOOL *stop) {
+        EFGeneratedProperty *property = [EFGeneratedProperty propertyForClass:aClass key:mapping.internalKey];
+        NSArray *accessorDeclarations = [property accessorDeclarations];
+        if ([accessorDeclarations count] > 0) {
+            [declarations addObjectsFromArray:accessorDeclarations];
+            [declaredClassNames addObject:NSStringFromClass(property.objectClass)];
+        }
+        NSString *transformFunction = nil;
+        if ([self isSpecializedMapping:mapping property:property]) {
+            if (mapping.transformer) {
+                transformFunction = [NSString stringWithFormat:@"EFGenerated%@_%@", EFIdentifier(className), EFIdentifier(mapping.internalKey)];
+                [functions appendString:[self functionNamed:transformFunction forEnumTransformer:(EFEnumTransformer *)mapping.transformer]];
+            }
+            [validation appendString:[self validationForMapping:mapping index:idx property:property transformFunction:transformFunction]];
+            [setting appendString:[self settingForMapping:mapping index:idx property:property transformFunction:transformFunction]];
+            [representation appendString:[self representationForMapping:mapping property:property transformFunction:transformFunction]];
+        } else {
+            [validation appendFormat:@"    [self validateValues:values mapping:mappings[%lu] onObject:object errors:errors];\n", (unsigned long)idx];
+            [setting appendFormat:@"    [self setValues:values onObject:object mapping:mappings[%lu] error:error];\n", (unsigned long)idx];
+            [representation appendFormat:@"    if (!keys || [keys containsObject:%@]) {\n", EFStringLiteral(mapping.externalKey)];
+            [representation appendFormat:@"        [self addDictionaryRepresentationOfObject:object mapping:mappings[%lu] toDictionary:dictionary];\n", (unsigned long)idx];
+            [representation appendString:@"    }\n"];
+        }
+        [encoding appendString:[self encodingForMapping:mapping property:property]];
+        [decoding appendString:[self decodingForMapping:mapping property:property]];
+    }];
+
+    NSMutableString *source = [NSMutableString string];
+    [source appendFormat:@"\n#pragma mark - %@\n", className];
+    if ([functions length] > 0) {
+        [source appendFormat:@"%@\n", functions];
+    } else {
+        [source appendString:@"\n"];
+    }
+    if ([declarations count] > 0) {
+        NSArray *classNames = [[declaredClassNames allObjects] sortedArrayUsingSelector:@selector(compare:)];
+        [source appendFormat:@"@class %@;\n\n", [classNames componentsJoinedByString:@", "]];
+        [source appendFormat:@"@interface %@ (EFGeneratedAccessors)\n\n", className];
+        [source appendFormat:@"%@\n\n", [[declarations array] componentsJoinedByString:@"\n"]];
+        [source appendString:@"@end\n\n"];
+    }
+    [source appendFormat:@"@interface %@ : EFCompiledMapper\n\n@end\n\n", mapperName];
+    [source appendFormat:@"@implementation %@\n\n", mapperName];
+
+    [source appendString:@"- (BOOL)validateValues:(NSDictionary *)values forClass:(Class)aClass onObject:(id)object error:(NSError **)error {\n"];
+    [source appendString:@"    if (aClass != self.compiledClass || ![values isKindOfClass:[NSDictionary class]]) {\n"];
+    [source appendString:@"        return [super validateValues:values forClass:aClass onObject:object error:error];\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:[self mappingsDeclarationForBody:validation]];
+    [source appendString:@"    NSMutableDictionary *errors = [NSMutableDictionary dictionary];\n"];
+    [source appendString:validation];
+    [source appendString:@"    return [self validationResultWithErrors:errors forClass:aClass error:error];\n"];
+    [source appendString:@"}\n\n"];
+
+    [source appendString:@"- (BOOL)setValues:(NSDictionary *)values onObject:(id)object error:(NSError **)error {\n"];
+    [source appendString:@"    if ([object class] != self.compiledClass) {\n"];
+    [source appendString:@"        return [super setValues:values onObject:object error:error];\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:@"    if (![self validateValues:values onObject:object error:error]) {\n"];
+    [source appendString:@"        return NO;\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:[self mappingsDeclarationForBody:setting]];
+    [source appendString:setting];
+    [source appendString:@"    return YES;\n"];
+    [source appendString:@"}\n\n"];
+
+    [source appendString:@"- (void)encodeObject:(id)object withCoder:(NSCoder *)aCoder {\n"];
+    [source appendString:@"    if ([object class] != self.compiledClass) {\n"];
+    [source appendString:@"        return [super encodeObject:object withCoder:aCoder];\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:encoding];
+    [source appendString:@"}\n\n"];
+
+    [source appendString:@"- (void)decodeObject:(id)object withCoder:(NSCoder *)aDecoder {\n"];
+    [source appendString:@"    if ([object class] != self.compiledClass) {\n"];
+    [source appendString:@"        return [super decodeObject:object withCoder:aDecoder];\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:decoding];
+    [source appendString:@"}\n\n"];
+
+    [source appendString:@"- (id)dictionaryRepresentationOfObject:(id)object forKeys:(NSArray *)keys {\n"];
+    [source appendString:@"    if ([object class] != self.compiledClass) {\n"];
+    [source appendString:@"        return [super dictionaryRepresentationOfObject:object forKeys:keys];\n"];
+    [source appendString:@"    }\n\n"];
+    [source appendString:[self mappingsDeclarationForBody:representation]];
+    [source appendString:@"    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];\n"];
+    [source appendString:representation];
+    [source appendString:@"    return [dictionary copy];\n"];
+    [source appendString:@"}\n\n"];
+
+    [source appendString:@"@end\n"];
+    return source;
+}
+
+- (NSString *)mappingsDeclarationForBody:(NSString *)body {
+    if ([body rangeOfString:@"mappings["].location == NSNotFound) {
+        return @"";
+    }
+    return @"    NSArray *mappings = self.compiledMappings;\n";
+}
+
+#pragma mark - Mappings
+- (BOOL)isSpecializedMapping:(EFMapping *)mapping property:(EFGeneratedProperty *)property {
+    if (mapping.type != EFMappingTypeId || mapping.formatter || mapping.transformationBlock) {
+        return NO;
+    }
+    if (mapping.transformer && ![self isInlinableEnumTransformer:mapping.transformer]) {
+        return NO;
+    }
+    if ((mapping.internalClass != [NSString class] && mapping.internalClass != [NSNumber class]) || [self.mapper mappingsForClass:mapping.internalClass]) {
+        return NO;
+    }
+    if (!property.gettable || !property.settable) {
+        return NO;
+    }
+    if ([property isPrimitive]) {
+        return mapping.internalClass == [NSNumber class];
+    }
+    return [property isObject] && ([property.objectClass isSubclassOfClass:[NSString class]] || [property.objectClass isSubclassOfClass:[NSNumber class]]);
+}
+
+- (BOOL)isInlinableEnumTransformer:(NSValueTransformer *)transformer {
+    if ([transformer class] != [EFEnumTransformer class]) {
+        return NO;
+    }
+    __block BOOL inlinable = YES;
+    [((EFEnumTransformer *)transformer).enumMapping enumerateKeysAndObjectsUsingBlock:^(id key, id obj, BOOL *stop) {
+        if (![key isKindOfClass:[NSNumber class]] || ![obj isKindOfClass:[NSString class]]) {
+            inlinable = NO;
+            *stop = YES;
+        }
+    }];
+    return inlinable;
+}
+
+- (NSString *)functionNamed:(NSString *)name forEnumTransformer:(EFEnumTransformer *)transformer {
+    // Same lookup as -[EFEnumTransformer transformedValue:], resolved ahead of time
+    NSDictionary *enumMapping = transformer.enumMapping;
+    NSArray *strings = [[[NSSet setWithArray:[enumMapping allValues]] allObjects] sortedArrayUsingSelector:@selector(compare:)];
+
+    NSMutableString *function = [NSMutableString string];
+    [function appendFormat:@"\nstatic NSNumber *%@(id value) {\n", name];
+    for (NSString *string in strings) {
+        NSInteger enumValue = [[[enumMapping allKeysForObject:string] firstObject] integerValue];
+        [function appendFormat:@"    if ([value isEqual:%@]) {\n", EFStringLiteral(string)];
+        [function appendFormat:@"        return @((NSInteger)%ld);\n", (long)enumValue];
+        [function appendString:@"    }\n"];
+    }
+    [function appendString:@"    return @((NSInteger)0);\n"];
+    [function appendString:@"}\n"];
+    return function;
+}
+
+- (NSString *)validationForMapping:(EFMapping *)mapping index:(NSUInteger)idx property:(EFGeneratedProperty *)property transformFunction:(NSString *)transformFunction {
+    NSString *key = EFStringLiteral(mapping.internalKey);
+    NSMutableString *code = [NSMutableString string];
+    [code appendString:@"    {\n"];
+    [code appendFormat:@"        id value = values[%@];\n", EFStringLiteral(mapping.externalKey)];
+    if (transformFunction) {
+        [code appendFormat:@"        id validatedValue = %@(value);\n", transformFunction];
+    } else {
+        [code appendString:@"        id validatedValue = value;\n"];
+    }
+    [code appendString:@"        if ([validatedValue isKindOfClass:[NSNull class]]) {\n"];
+    [code appendString:@"            validatedValue = nil;\n"];
+    [code appendString:@"        }\n"];
+
+    NSString *classCheck = [NSString stringWithFormat:@"if (validatedValue && ![validatedValue isKindOfClass:[%@ class]]) {\n", NSStringFromClass(mapping.internalClass)];
+    if (mapping.requires) {
+        [code appendFormat:@"        if (![[mappings[%lu] requires] evaluateForValue:validatedValue]) {\n", (unsigned long)idx];
+        [code appendFormat:@"            NSString *description = [NSString stringWithFormat:%@, validatedValue, NSStringFromClass([validatedValue class])];\n", EFStringLiteral([NSString stringWithFormat:@"Did not pass requirements for value (%%@) of class %%@ for key %@", [mapping.internalKey stringByReplacingOccurrencesOfString:@"%" withString:@"%%"]])];
+        [code appendFormat:@"            errors[%@] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingRequirementsFailed userInfo:@{NSLocalizedDescriptionKey: description}];\n", key];
+        [code appendFormat:@"        } else %@", classCheck];
+    } else {
+        [code appendFormat:@"        %@", classCheck];
+    }
+    [code appendFormat:@"            NSString *description = [NSString stringWithFormat:%@, validatedValue, NSStringFromClass([validatedValue class])];\n", EFStringLiteral([NSString stringWithFormat:@"Did not expect value (%%@) of class %%@ for key %@ but a %@ instance", [mapping.internalKey stringByReplacingOccurrencesOfString:@"%" withString:@"%%"], NSStringFromClass(mapping.internalClass)])];
+    [code appendFormat:@"            errors[%@] = [NSError errorWithDomain:EFMappingErrorDomain code:EFMappingUnexpectedClass userInfo:@{NSLocalizedDescriptionKey: description}];\n", key];
+    [code appendString:@"        }\n"];
+
+    // Classes may override -validateValue:forKey:error: instead of implementing validate<Key>:error:, like NSManagedObject does
+    [code appendString:@"        NSError *validationError;\n"];
+    [code appendFormat:@"        if (object && ![object validateValue:&value forKey:%@ error:&validationError]) {\n", key];
+    [code appendFormat:@"            errors[%@] = validationError;\n", key];
+    [code appendString:@"        }\n"];
+    [code appendString:@"    }\n"];
+    return code;
+}
+
+- (NSString *)settingForMapping:(EFMapping *)mapping index:(NSUInteger)idx property:(EFGeneratedProperty *)property transformFunction:(NSString *)transformFunction {
+    NSMutableString *code = [NSMutableString string];
+    [code appendString:@"    {\n"];
+    if (transformFunction) {
+        [code appendFormat:@"        id value = %@(values[%@]);\n", transformFunction, EFStringLiteral(mapping.externalKey)];
+    } else {
+        [code appendFormat:@"        id value = values[%@];\n", EFStringLiteral(mapping.externalKey)];
+    }
+    [code appendString:@"        if (value) {\n"];
+    [code appendString:@"            if ([value isKindOfClass:[NSNull class]]) {\n"];
+    [code appendString:@"                value = nil;\n"];
+    [code appendString:@"            }\n"];
+    [code appendFormat:@"            [object validateValue:&value forKey:%@ error:NULL];\n", EFStringLiteral(mapping.internalKey)];
+    if (![property isPrimitive]) {
+        // Primitive properties don't keep the boxed value
+        [code appendFormat:@"            value = [self internedValue:value mapping:mappings[%lu]];\n", (unsigned long)idx];
+    }
+    [code appendString:[property setterStatementForValue:@"value" indent:@"            "]];
+    [code appendString:@"        }\n"];
+    [code appendString:@"    }\n"];
+    return code;
+}
+
+- (NSString *)representationForMapping:(EFMapping *)mapping property:(EFGeneratedProperty *)property transformFunction:(NSString *)transformFunction {
+    NSMutableString *code = [NSMutableString string];
+    [code appendFormat:@"    if (!keys || [keys containsObject:%@]) {\n", EFStringLiteral(mapping.externalKey)];
+    [code appendFormat:@"        id child = %@;\n", [property getterExpression]];
+    if (transformFunction) {
+        // -[EFMapper transformValue:mapping:reverse:error:] applies transformers in forward direction only
+        [code appendFormat:@"        dictionary[%@] = child ? %@(child) : [NSNull null];\n", EFStringLiteral(mapping.externalKey), transformFunction];
+    } else {
+        [code appendFormat:@"        dictionary[%@] = child ?: [NSNull null];\n", EFStringLiteral(mapping.externalKey)];
+    }
+    [code appendString:@"    }\n"];
+    return code;
+}
+
+- (NSString *)encodingForMapping:(EFMapping *)mapping property:(EFGeneratedProperty *)property {
+    NSString *getter = property ? [property getterExpression] : [NSString stringWithFormat:@"[object valueForKey:%@]", EFStringLiteral(mapping.internalKey)];
+    return [NSString stringWithFormat:@"    [aCoder encodeObject:%@ forKey:%@];\n", getter, EFStringLiteral(mapping.internalKey)];
+}
+
+- (NSString *)decodingForMapping:(EFMapping *)mapping property:(EFGeneratedProperty *)property {
+    Class decodedClass = nil;
+    switch (mapping.type) {
+        case EFMappingTypeId:
+            decodedClass = mapping.internalClass;
+            break;
+        case EFMappingTypeCollection:
+            decodedClass = mapping.collectionClass;
+            break;
+        default:
+            return @"";
+    }
+
+    NSMutableString *code = [NSMutableString string];
+    [code appendString:@"    {\n"];
+    [code appendFormat:@"        id value = [aDecoder decodeObjectOfClass:[%@ class] forKey:%@];\n", NSStringFromClass(decodedClass), EFStringLiteral(mapping.internalKey)];
+    BOOL direct = property && (([property isPrimitive] && decodedClass == [NSNumber class]) || ([property isObject] && [decodedClass isSubclassOfClass:property.objectClass]));
+    if (direct) {
+        [code appendString:[property setterStatementForValue:@"value" indent:@"        "]];
+    } else {
+        [code appendFormat:@"        [object setValue:value forKey:%@];\n", EFStringLiteral(mapping.internalKey)];
+    }
+    [code appendString:@"    }\n"];
+    return code;
+}
+
+@end
@@ -0,0 +1,121 @@
+//
+//  main.m
+//  efmapgen
+//
+//  Created by agent on 19/10/2026.
+//  Copyright (c) 2026 Egeniq. All rights reserved.
+//
+//  Generates compiled mappers for the mappings registered by a bundle.
+//
+//  Build the tool with `make` in this directory; `make check` also verifies the generated sample in EFMappingTests.
+//
+//  Build your model classes, and a function registering their mappings unless the classes adopt EFMappable, into a loadable bundle linked against the tool:
+//
+//      clang -fobjc-arc -bundle -bundle_loader efmapgen -framework Foundation -include Foundation/Foundation.h -I EFMapping MYModels/*.m -o MYModels.bundle
+//
+//  Then generate:
+//
+//      efmapgen -bundle MYModels.bundle -setup MYRegisterMappings -import MYUser.h -import MYMessage.h -function MYRegisterCompiledMappers -output MYCompiledMappers.m MYUser MYMessage
+//
+//  Leave out -setup when the classes provide their mappings through +ef_mappings.
+//
+
+#import <Foundation/Foundation.h>
+
+#import <dlfcn.h>
+
+#import "EFDataMappingKit.h"
+#import "EFMappingCodeGenerator.h"
+
+typedef void (*EFMappingSetupFunction)(EFMapper *mapper);
+
+static void EFPrintUsage(void) {
+    fprintf(stderr, "usage: efmapgen -bundle <path> [-setup <function>] [-import <header>]... [-function <name>] [-output <path>] <class>...\n");
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        NSString *bundlePath = nil;
+        NSString *setupName = nil;
+        NSString *functionName = nil;
+        NSString *outputPath = nil;
+        NSMutableArray *imports = [NSMutableArray array];
+        NSMutableArray *classNames = [NSMutableArray array];
+
+        for (int i = 1; i < argc; i++) {
+            NSString *argument = [NSString stringWithUTF8String:argv[i]];
+            BOOL hasValue = i + 1 < argc;
+            if ([argument isEqualToString:@"-bundle"] && hasValue) {
+                bundlePath = [NSString stringWithUTF8String:argv[++i]];
+            } else if ([argument isEqualToString:@"-setup"] && hasValue) {
+                setupName = [NSString stringWithUTF8String:argv[++i]];
+            } else if ([argument isEqualToString:@"-import"] && hasValue) {
+                [imports addObject:[NSString stringWithUTF8String:argv[++i]]];
+            } else if ([argument isEqualToString:@"-function"] && hasValue) {
+                functionName = [NSString stringWithUTF8String:argv[++i]];
+            } else if ([argument isEqualToString:@"-output"] && hasValue) {
+                outputPath = [NSString stringWithUTF8String:argv[++i]];
+            } else if ([argument hasPrefix:@"-"]) {
+                EFPrintUsage();
+                return 1;
+            } else {
+                [classNames addObject:argument];
+            }
+        }
+
+        if (!bundlePath || [classNames count] == 0) {
+            EFPrintUsage();
+            return 1;
+        }
+
+        // Accept both a plain loadable object and a bundle directory
+        NSString *executablePath = bundlePath;
+        BOOL isDirectory = NO;
+        if ([[NSFileManager defaultManager] fileExistsAtPath:bundlePath isDirectory:&isDirectory] && isDirectory) {
+            executablePath = [[NSBundle bundleWithPath:bundlePath] executablePath];
+        }
+        if (!executablePath || !dlopen([executablePath fileSystemRepresentation], RTLD_NOW | RTLD_GLOBAL)) {
+            fprintf(stderr, "efmapgen: could not load bundle %s: %s\n", [bundlePath UTF8String], executablePath ? dlerror() : "no executable");
+            return 1;
+        }
+
+        // Classes adopting EFMappable are resolved by the mapper on demand
+        EFMapper *mapper = [[EFMapper alloc] init];
+        if (setupName) {
+            EFMappingSetupFunction setup = (EFMappingSetupFunction)dlsym(RTLD_DEFAULT, [setupName UTF8String]);
+            if (!setup) {
+                fprintf(stderr, "efmapgen: could not find function %s\n", [setupName UTF8String]);
+                return 1;
+            }
+            setup(mapper);
+        }
+
+        NSMutableArray *classes = [NSMutableArray arrayWithCapacity:[classNames count]];
+        for (NSString *className in classNames) {
+            Class aClass = NSClassFromString(className);
+            if (!aClass) {
+                fprintf(stderr, "efmapgen: could not find class %s\n", [className UTF8String]);
+                return 1;
+            }
+            [classes addObject:aClass];
+        }
+
+        EFMappingCodeGenerator *generator = [[EFMappingCodeGenerator alloc] initWithMapper:mapper];
+        generator.imports = imports;
+        if (functionName) {
+            generator.registrationFunctionName = functionName;
+        }
+        NSString *source = [generator sourceForClasses:classes];
+
+        NSError *error = nil;
+        if (outputPath) {
+            if (![source writeToFile:outputPath atomically:YES encoding:NSUTF8StringEncoding error:&error]) {
+                fprintf(stderr, "efmapgen: could not write %s: %s\n", [outputPath UTF8String], [[error localizedDescription] UTF8String]);
+                return 1;
+            }
+        } else {
+            fputs([source UTF8String], stdout);
+        }
+    }
+    return 0;
+}